@@ -39,6 +39,7 @@ public:
 		FileNotFound,
 		InputSizeError,
 		WrongArgsValue,
+		Network,
 		_count // Helper for array size
 	};
 
@@ -69,7 +70,8 @@ private:
 		"WrongTimeLimit",
 		"FileNotFound",
 		"InputSizeError",
-		"WrongArgsValue"
+		"WrongArgsValue",
+		"Network"
 	};
 
 	/**
@@ -0,0 +1,217 @@
+/**
+ * @file AutoConfig.hpp
+ * @brief This file defines the AutoConfig class, which picks the ACS parameters of an instance
+ *        from the static features of its original MIP.
+ *
+ * The selector is a rule table. A rule is a conjunction of conditions on the features of the
+ * instance (see InstanceFeatures) followed by parameter assignments:
+ *
+ *     nnz > 1e6 && eqFrac < 0.5 : rho=0.5 detScale=2
+ *
+ * The rules are checked in order, starting from the CLI values: every matching rule overrides
+ * the parameters it assigns. The built-in table (AUTO_CONFIG_RULES) can be replaced by a text
+ * file with one rule per line; empty lines and lines starting with '#' are skipped.
+ *
+ * Features:   rows, cols, nnz, density, binFrac, intFrac, contFrac, rowLenMean, rowLenStd,
+ *             rowLenMin, rowLenMax, eqFrac
+ * Operators:  <, <=, >, >=, ==
+ * Parameters: rho, numsubMIPs, fixPolicy (PolicyPortfolio::Policy id), detScale (base scale
+ *             of DET_TL(nnz), see DetBudget::setBaseScale)
+ *
+ * @author Francesco Biscaccia Carrara
+ * @version v1.2.11
+ * @since 15/09/2025
+ */
+
+#ifndef AUTO_CONFIG_H
+#define AUTO_CONFIG_H
+
+#include "MIP.hpp"
+using namespace Utils;
+
+#pragma region AUTO_CONFIG_DEF
+
+/**
+ * Built-in rule table (same syntax as a rules file): short solves on small instances, smaller
+ * neighborhoods and longer solves on large ones, fewer models in memory on huge ones, connected
+ * free sets on equality-heavy ones (scattered fixings are often infeasible), root LP guidance
+ * on mostly continuous ones
+ */
+#define AUTO_CONFIG_RULES { "nnz < 1e4 : detScale=0.5", "nnz > 1e6 : rho=0.5 detScale=2", "nnz > 1e7 : rho=0.7 numsubMIPs=2", "eqFrac > 0.5 : fixPolicy=3", "contFrac > 0.5 : fixPolicy=5" }
+/** Upper bound of the numsubMIPs a rule can assign */
+#define AUTO_CONFIG_MAX_SUBMIPS 256
+/** Upper bound of the DET_TL scale a rule can assign */
+#define AUTO_CONFIG_MAX_DET_SCALE 100.0
+
+#pragma endregion
+
+/**
+ * @class AutoConfig
+ * @brief Rule-based selector of the ACS parameters of an instance.
+ *
+ * Used by the main thread only, before the workers are started.
+ */
+class AutoConfig {
+
+public:
+	/**
+	 * @struct Config
+	 * @brief Parameters chosen for an instance.
+	 */
+	struct Config {
+		double				rho;		///< Initial fixing ratio
+		size_t				numsubMIPs; ///< Number of parallel subMIPs
+		size_t				fixPolicy;	///< Fixing policy used when the portfolio is off
+		double				detScale;	///< Base scale of DET_TL(nnz)
+		std::vector<size_t> matched;	///< Indices of the rules that matched, in order
+	};
+
+	/**
+	 * @brief Loads the rule table.
+	 *
+	 * @param rulesFile Path of a rules file (empty: built-in table).
+	 * @throws AutoConfigException if the file cannot be read or a rule is malformed.
+	 */
+	AutoConfig(const std::string& rulesFile = "");
+
+	/// Explicitly delete copy constructor and copy assignment operator
+	AutoConfig(const AutoConfig&) = delete;
+	AutoConfig& operator=(const AutoConfig&) = delete;
+
+	/**
+	 * @brief Picks the parameters of an instance.
+	 *
+	 * @param features Features of the original MIP.
+	 * @param CLIArgs CLI arguments (values kept where no rule applies).
+	 * @return Chosen configuration.
+	 */
+	[[nodiscard]]
+	Config select(const InstanceFeatures& features, const Args& CLIArgs) const;
+
+	/**
+	 * @brief Gets the text of a rule.
+	 *
+	 * @param index Index of the rule.
+	 * @return Rule as written in the table.
+	 */
+	[[nodiscard]]
+	inline const std::string& getRule(size_t index) const { return rules[index].text; }
+
+	/**
+	 * @brief Gets the number of rules of the table.
+	 *
+	 * @return Number of rules.
+	 */
+	[[nodiscard]]
+	inline size_t getNumRules() const { return rules.size(); }
+
+	/**
+	 * @brief Gets the number of features a rule can test.
+	 *
+	 * @return Number of features.
+	 */
+	[[nodiscard]]
+	static constexpr size_t numFeatures() { return featureTable.size(); }
+
+	/**
+	 * @brief Gets the name of a feature.
+	 *
+	 * @param index Index of the feature.
+	 * @return Name of the feature.
+	 */
+	[[nodiscard]]
+	static const char* featureName(size_t index) { return featureTable[index].name; }
+
+	/**
+	 * @brief Gets the value of a feature.
+	 *
+	 * @param features Features of the original MIP.
+	 * @param index Index of the feature.
+	 * @return Value of the feature.
+	 * @throws AutoConfigException if the index is out of range.
+	 */
+	[[nodiscard]]
+	static double featureValue(const InstanceFeatures& features, size_t index);
+
+	/**
+	 * @class AutoConfigException
+	 * @brief Exception class for handling rule table errors.
+	 */
+	class AutoConfigException : public ACSException {
+	public:
+		AutoConfigException(ExceptionType type, const std::string& message) : ACSException(type, message, "AutoConfig") {}
+	};
+
+private:
+	/**
+	 * @enum Param
+	 * @brief Parameters a rule can assign.
+	 */
+	enum class Param : size_t {
+		Rho,
+		NumSubMIPs,
+		FixPolicy,
+		DetScale,
+		_count // Helper for array size
+	};
+
+	/**
+	 * @struct Condition
+	 * @brief Comparison of a feature with a constant.
+	 */
+	struct Condition {
+		size_t		feature; ///< Index of the feature
+		std::string op;		 ///< Comparison operator
+		double		value;	 ///< Constant
+	};
+
+	/**
+	 * @struct Rule
+	 * @brief Conditions (all must hold) and parameter assignments.
+	 */
+	struct Rule {
+		std::vector<Condition>				   conditions;	///< Conditions of the rule
+		std::vector<std::pair<Param, double>> assignments; ///< Parameters set when the rule matches
+		std::string							   text;		///< Rule as written in the table
+	};
+
+	/**
+	 * @struct Feature
+	 * @brief Name of a feature and accessor of its value.
+	 */
+	struct Feature {
+		const char* name;							   ///< Name used in the rules
+		double (*value)(const InstanceFeatures& features); ///< Value of the feature
+	};
+
+	/// Static table of the features a rule can test (a new InstanceFeatures member needs only a new entry)
+	static constexpr std::array<Feature, 12> featureTable = { {
+		{ "rows", [](const InstanceFeatures& f) { return static_cast<double>(f.rows); } },
+		{ "cols", [](const InstanceFeatures& f) { return static_cast<double>(f.cols); } },
+		{ "nnz", [](const InstanceFeatures& f) { return static_cast<double>(f.nnz); } },
+		{ "density", [](const InstanceFeatures& f) { return f.density; } },
+		{ "binFrac", [](const InstanceFeatures& f) { return f.binFrac; } },
+		{ "intFrac", [](const InstanceFeatures& f) { return f.intFrac; } },
+		{ "contFrac", [](const InstanceFeatures& f) { return f.contFrac; } },
+		{ "rowLenMean", [](const InstanceFeatures& f) { return f.rowLenMean; } },
+		{ "rowLenStd", [](const InstanceFeatures& f) { return f.rowLenStd; } },
+		{ "rowLenMin", [](const InstanceFeatures& f) { return static_cast<double>(f.rowLenMin); } },
+		{ "rowLenMax", [](const InstanceFeatures& f) { return static_cast<double>(f.rowLenMax); } },
+		{ "eqFrac", [](const InstanceFeatures& f) { return f.eqFrac; } },
+	} };
+
+	/// Static array of parameter names
+	static constexpr std::array<const char*, static_cast<size_t>(Param::_count)> paramNames = { "rho", "numsubMIPs", "fixPolicy", "detScale" };
+
+	std::vector<Rule> rules; ///< Rule table
+
+	/**
+	 * @brief Parses a rule and appends it to the table.
+	 *
+	 * @param text Rule (see the file description for the syntax).
+	 * @throws AutoConfigException if the rule is malformed.
+	 */
+	void addRule(const std::string& text);
+};
+
+#endif
@@ -0,0 +1,159 @@
+/**
+ * @file CoreScheduler.hpp
+ * @brief This file defines the CoreScheduler class, which splits the available cores
+ *        among the subMIPs solved concurrently by ACS.
+ *
+ * Every running worker gets an even share of the core budget. When a worker finishes,
+ * its cores go back to the pool and the workers still running (the stragglers) get a
+ * larger share the next time they ask for it. Merge MIPs use the whole budget.
+ *
+ * Optionally (placement mode), the scheduler reads the NUMA topology of the machine,
+ * gives each worker a home set of logical CPUs on a single node and pins the worker
+ * thread (and its CPLEX threads) to it: models and solution buffers created by the
+ * worker are then first-touched on its local node.
+ *
+ * @author Francesco Biscaccia Carrara
+ * @version v1.2.11
+ * @since 15/09/2025
+ */
+
+#ifndef CORE_SCHED_H
+#define CORE_SCHED_H
+
+#include <mutex>
+
+#include "Utils.hpp"
+using namespace Utils;
+
+#pragma region CORE_SCHED_DEF
+
+/** Number of slices a subMIP deterministic budget is split into to rebalance cores */
+#define CORE_SCHED_SLICES 4
+/** Directory of the NUMA nodes description (Linux sysfs) */
+#define CORE_SCHED_NODE_DIR "/sys/devices/system/node/"
+
+#pragma endregion
+
+/**
+ * @class CoreScheduler
+ * @brief Thread-safe scheduler of the CPLEX threads given to each subMIP.
+ */
+class CoreScheduler {
+
+public:
+	/**
+	 * @brief Constructs a scheduler for a core budget.
+	 *
+	 * @param numCores Total number of cores ACS can use.
+	 * @param numWorkers Maximum number of concurrent workers.
+	 * @param pin Whether workers are pinned to NUMA-local core sets.
+	 */
+	CoreScheduler(size_t numCores, size_t numWorkers, bool pin = false);
+
+	/// Explicitly delete copy constructor and copy assignment operator
+	CoreScheduler(const CoreScheduler&) = delete;
+	CoreScheduler& operator=(const CoreScheduler&) = delete;
+
+	/**
+	 * @brief Marks the first numWorkers workers as running (start of a parallel phase).
+	 *
+	 * @param numWorkers Number of workers of the phase.
+	 */
+	void startPhase(size_t numWorkers);
+
+	/**
+	 * @brief Gives back the cores of a worker that finished its job.
+	 *
+	 * @param thID ID of the worker.
+	 */
+	void release(size_t thID);
+
+	/**
+	 * @brief Gets the current core share of a running worker.
+	 *
+	 * The budget is split evenly among the running workers; the remainder goes to the
+	 * workers with lower IDs.
+	 *
+	 * @param thID ID of the worker.
+	 * @return Number of cores the worker can use.
+	 */
+	[[nodiscard]]
+	size_t getShare(size_t thID);
+
+	/**
+	 * @brief Gets the core share of a worker at the start of the phase, ignoring the workers
+	 *        that finished since (deterministic mode).
+	 *
+	 * @param thID ID of the worker.
+	 * @return Number of cores the worker can use.
+	 */
+	[[nodiscard]]
+	size_t getPhaseShare(size_t thID);
+
+	/**
+	 * @brief Pins the calling thread to the home CPUs of a worker (placement mode only).
+	 *
+	 * Must be called by the worker thread before it allocates its model and buffers.
+	 *
+	 * @param thID ID of the worker.
+	 * @return True if the thread has been pinned.
+	 */
+	bool pinWorker(size_t thID);
+
+	/**
+	 * @brief Gets the CPUs the CPLEX threads of a worker can be bound to (placement mode only).
+	 *
+	 * The home CPUs of the worker come first, then the CPUs of the finished workers of
+	 * the same node and finally those of the other nodes, up to the given share.
+	 *
+	 * @param thID ID of the worker.
+	 * @param share Number of cores of the worker (see CoreScheduler::getShare).
+	 * @return IDs of the logical CPUs (empty if placement is off).
+	 */
+	[[nodiscard]]
+	std::vector<int> getCPUSet(size_t thID, size_t share);
+
+	/**
+	 * @brief Gets the total core budget (used by the merge MIPs).
+	 *
+	 * @return Number of cores.
+	 */
+	[[nodiscard]]
+	inline size_t getNumCores() const noexcept { return numCores; }
+
+	/**
+	 * @brief Checks whether the placement mode is on.
+	 *
+	 * @return True if workers are pinned.
+	 */
+	[[nodiscard]]
+	inline bool isPinned() const noexcept { return pinned; }
+
+private:
+	size_t							numCores;  ///< Total core budget.
+	bool							pinned;	   ///< Placement mode flag.
+	std::vector<bool>				running;   ///< Running flag of each worker.
+	size_t							numActive; ///< Number of running workers.
+	size_t							numPhase;  ///< Number of workers of the current phase.
+	std::vector<std::vector<int>>	nodeCPUs;  ///< CPUs of the budget on each NUMA node.
+	std::vector<std::vector<int>>	homeCPUs;  ///< Home CPUs of each worker.
+	std::vector<size_t>				homeNode;  ///< Home NUMA node of each worker.
+	std::mutex						schedMTX;  ///< Mutex for synchronizing the shares.
+
+	/**
+	 * @brief Reads the NUMA nodes and keeps numCores CPUs, spread evenly across the nodes.
+	 */
+	void readTopology();
+
+	/**
+	 * @brief Assigns workers to nodes (round-robin) and splits each node among its workers.
+	 */
+	void layoutWorkers();
+
+	/**
+	 * @brief Prints the topology and the placement chosen.
+	 */
+	void printTopology() const;
+};
+
+#endif
@@ -0,0 +1,245 @@
+/**
+ * @file DetBudget.hpp
+ * @brief This file defines the DetBudget class, which assigns the deterministic time limit
+ *        of every subMIP and merge MIP solved by ACS.
+ *
+ * Instead of the fixed DET_TL(nnz) formula, the budget of a solve is a scaled DET_TL(nnz):
+ * the scale is picked (per phase) among a small set of arms by an UCB rule on the improvement
+ * per deterministic tick observed in the previous solves, and capped by the remaining wall time.
+ * Ticks, solve status and improvement are recorded per phase and per worker.
+ *
+ * @author Francesco Biscaccia Carrara
+ * @version v1.2.11
+ * @since 15/09/2025
+ */
+
+#ifndef DET_BUDGET_H
+#define DET_BUDGET_H
+
+#include <mutex>
+
+#include "MIP.hpp"
+using namespace Utils;
+
+#pragma region DET_BUDGET_DEF
+
+/** Scales of DET_TL(nnz) the controller can choose from (base scale first) */
+#define DET_BUDGET_ARMS { 1.0, 0.5, 2.0, 0.25, 4.0 }
+/** Exploration weight of the UCB rule */
+#define DET_BUDGET_UCB_C 0.5
+/** Smoothing factor of the ticks per second estimate */
+#define DET_BUDGET_RATE_ALPHA 0.2
+
+#pragma endregion
+
+/**
+ * @class DetBudget
+ * @brief Adaptive controller of the deterministic time limits of ACS solves.
+ *
+ * The class is thread-safe: workers ask for a budget before solving their subMIP
+ * and record the outcome right after.
+ */
+class DetBudget {
+
+public:
+	/**
+	 * @enum Phase
+	 * @brief Kind of solve the budget is asked for.
+	 */
+	enum class Phase : size_t {
+		FMIP,
+		OMIP,
+		MergeFMIP,
+		MergeOMIP,
+		_count // Helper for array size
+	};
+
+	/**
+	 * @struct ArmStats
+	 * @brief Statistics of a DET_TL scale within a phase.
+	 */
+	struct ArmStats {
+		double scale;		///< Scale applied to DET_TL(nnz)
+		size_t picks;		///< Number of budgets given with this scale
+		size_t solves;		///< Number of recorded solves
+		double ticks;		///< Deterministic ticks used
+		double improvement; ///< Sum of the relative improvements
+	};
+
+	/**
+	 * @struct WorkerStats
+	 * @brief Statistics of the solves of a worker within a phase.
+	 */
+	struct WorkerStats {
+		size_t solves;		///< Number of recorded solves
+		double ticks;		///< Deterministic ticks used
+		double improvement; ///< Sum of the relative improvements
+		size_t optimal;		///< Solves ended with an optimal solution
+		size_t limit;		///< Solves ended by a time limit
+		size_t infeasible;	///< Solves ended infeasible (or without improving solutions)
+	};
+
+	/**
+	 * @struct Budget
+	 * @brief Deterministic time limit given to a solve.
+	 */
+	struct Budget {
+		double detTL; ///< Deterministic time limit (ticks)
+		size_t arm;	  ///< Index of the DET_TL scale used
+	};
+
+	/**
+	 * @brief Constructs a controller for the given number of workers.
+	 *
+	 * @param numWorkers Number of workers recording solves (merge MIPs use worker 0).
+	 * @param deterministic If true budgets never depend on the wall time left (deterministic mode).
+	 */
+	DetBudget(size_t numWorkers, bool deterministic = false);
+
+	/// Explicitly delete copy constructor and copy assignment operator
+	DetBudget(const DetBudget&) = delete;
+	DetBudget& operator=(const DetBudget&) = delete;
+
+	/**
+	 * @brief Gives the deterministic time limit of a new solve.
+	 *
+	 * @param phase Kind of solve.
+	 * @param nnz Number of non-zeros of the model to solve.
+	 * @param timeRemaining Wall time (in seconds) left to the run.
+	 * @return Budget of the solve.
+	 */
+	Budget getBudget(Phase phase, size_t nnz, double timeRemaining);
+
+	/**
+	 * @brief Picks the DET_TL scale of a future solve (deterministic mode: arms are reserved
+	 *        by the main thread in worker order before the phase starts).
+	 *
+	 * @param phase Kind of solve.
+	 * @return Index of the arm, to pass to DetBudget::getBudget.
+	 */
+	size_t reserveArm(Phase phase);
+
+	/**
+	 * @brief Gives the deterministic time limit of a new solve with an arm already reserved.
+	 *
+	 * @param phase Kind of solve.
+	 * @param arm Index returned by DetBudget::reserveArm.
+	 * @param nnz Number of non-zeros of the model to solve.
+	 * @param timeRemaining Wall time (in seconds) left to the run.
+	 * @return Budget of the solve.
+	 */
+	Budget getBudget(Phase phase, size_t arm, size_t nnz, double timeRemaining);
+
+	/**
+	 * @brief Sets the base scale of DET_TL(nnz) every arm multiplies (1.0 by default).
+	 * Call before the first budget is given out.
+	 *
+	 * @param scale Base scale of the instance (see AutoConfig).
+	 */
+	inline void setBaseScale(double scale) { baseScale = scale; }
+
+	/**
+	 * @brief Gets the base scale of DET_TL(nnz).
+	 *
+	 * @return Base scale.
+	 */
+	[[nodiscard]]
+	inline double getBaseScale() const { return baseScale; }
+
+	/**
+	 * @brief Records the outcome of a solve.
+	 *
+	 * @param phase Kind of solve.
+	 * @param thID ID of the worker that solved the model.
+	 * @param budget Budget returned by DetBudget::getBudget for this solve.
+	 * @param ticks Deterministic ticks actually used.
+	 * @param wallTime Wall time (in seconds) of the solve.
+	 * @param solveCode Code returned by CPXgetstat.
+	 * @param improvement Relative improvement obtained (see DetBudget::improvement).
+	 */
+	void record(Phase phase, size_t thID, const Budget& budget, double ticks, double wallTime, int solveCode, double improvement);
+
+	/**
+	 * @brief Gets the statistics of the DET_TL scales of a phase.
+	 * BE CAREFULL:: use only in a single-thread scenario!
+	 *
+	 * @param phase Kind of solve.
+	 * @return Vector of arm statistics.
+	 */
+	[[nodiscard]]
+	inline const std::vector<ArmStats>& getArmStats(Phase phase) { return armStats[static_cast<size_t>(phase)]; }
+
+	/**
+	 * @brief Gets the statistics of the workers of a phase.
+	 * BE CAREFULL:: use only in a single-thread scenario!
+	 *
+	 * @param phase Kind of solve.
+	 * @return Vector of worker statistics.
+	 */
+	[[nodiscard]]
+	inline const std::vector<WorkerStats>& getWorkerStats(Phase phase) { return workerStats[static_cast<size_t>(phase)]; }
+
+	/**
+	 * @brief Gets the estimated deterministic ticks per second of a phase.
+	 *
+	 * @param phase Kind of solve.
+	 * @return Ticks per second (0 if no solve has been recorded yet).
+	 */
+	[[nodiscard]]
+	inline double getTickRate(Phase phase) { return tickRate[static_cast<size_t>(phase)]; }
+
+	/**
+	 * @brief Gets the name of a phase.
+	 *
+	 * @param phase Kind of solve.
+	 * @return Name of the phase.
+	 */
+	[[nodiscard]]
+	static const char* phaseName(Phase phase) { return phaseNames[static_cast<size_t>(phase)]; }
+
+	/**
+	 * @brief Relative improvement of a solution over a reference (the incumbent before the solve).
+	 *
+	 * The slack sum is compared while the reference is infeasible, the objective cost afterwards.
+	 *
+	 * @param ref Reference solution.
+	 * @param sol Solution obtained.
+	 * @return Relative improvement in [0,1].
+	 */
+	[[nodiscard]]
+	static double improvement(const Solution& ref, const Solution& sol);
+
+private:
+	static constexpr size_t NUM_PHASES{ static_cast<size_t>(Phase::_count) };
+
+	/// Static array of phase names
+	static constexpr std::array<const char*, NUM_PHASES> phaseNames = { "FMIP", "OMIP", "MergeFMIP", "MergeOMIP" };
+
+	std::array<std::vector<ArmStats>, NUM_PHASES>	 armStats;	  ///< Statistics per phase and arm
+	std::array<std::vector<WorkerStats>, NUM_PHASES> workerStats; ///< Statistics per phase and worker
+	std::array<double, NUM_PHASES>					 tickRate;	  ///< Ticks per second per phase
+	bool											 deterministic; ///< True if the wall time cap is off
+	double											 baseScale{ 1.0 }; ///< Scale of DET_TL(nnz) shared by all the arms
+	std::mutex										 budgetMTX;	  ///< Mutex for synchronizing the statistics
+
+	/**
+	 * @brief Picks the arm of the next solve of a phase (UCB on improvement per tick).
+	 *
+	 * @param phase Kind of solve.
+	 * @return Index of the arm.
+	 */
+	size_t pickArm(Phase phase);
+
+	/**
+	 * @brief Computes the budget of an arm (callers hold budgetMTX).
+	 *
+	 * @param phase Kind of solve.
+	 * @param arm Index of the arm.
+	 * @param nnz Number of non-zeros of the model to solve.
+	 * @param timeRemaining Wall time (in seconds) left to the run.
+	 * @return Budget of the solve.
+	 */
+	Budget armBudget(Phase phase, size_t arm, size_t nnz, double timeRemaining);
+};
+
+#endif
@@ -0,0 +1,298 @@
+/**
+ * @file Distributed.hpp
+ * @brief This file defines the DistCoordinator and DistWorker classes, which run ACS
+ *        across several processes (same host or other nodes) connected by TCP sockets.
+ *
+ * The coordinator is a regular ACS run: it holds the incumbent, solves its local subMIPs
+ * and the merge MIPs. At every parallel phase it also sends a neighborhood spec to each
+ * worker process: kind of subMIP, fixing policy, rho and the seed of the fixing draw.
+ * Each worker loads the instance once, rebuilds the subMIP from the spec and sends back
+ * the solution found, which joins the recombination of the phase.
+ *
+ * Wire format: a fixed-size header followed by the payload. Solutions travel as deltas
+ * (index, value) against the last copy the other side already holds (the reference solution
+ * of the previous job), so the traffic of a job depends on how much the solutions change,
+ * not on the size of the model. Messages are in host byte order: all the processes must run
+ * on the same architecture.
+ *
+ * Local test:  ./ACS -f <name> -tl 600 -co 5555 -nr 3  &  (three times) ./ACS -f <name> -tl 600 -wk 5555
+ *
+ * @author Francesco Biscaccia Carrara
+ * @version v1.2.11
+ * @since 15/09/2025
+ */
+
+#ifndef DISTRIBUTED_H
+#define DISTRIBUTED_H
+
+#include <cstdint>
+
+#include "ACSException.hpp"
+#include "DetBudget.hpp"
+#include "PolicyPortfolio.hpp"
+using namespace Utils;
+
+#pragma region DISTRIBUTED_DEF
+
+/** Seconds the coordinator waits for its workers to connect */
+#define DIST_ACCEPT_TL 30.0
+/** Seconds a worker keeps trying to reach the coordinator */
+#define DIST_CONNECT_TL 30.0
+/** Seconds the coordinator waits for a result after the time limit of the job */
+#define DIST_GRACE_TL 10.0
+/** Maximum length of the pending connections queue */
+#define DIST_BACKLOG 64
+/** Maximum payload of a message (bytes): larger headers are corrupt, the connection is dropped */
+#define DIST_MAX_MSG_SIZE (1ULL << 30)
+/** Multiplier of the estimated wall time of a remote job (remote cores may be slower) */
+#define DIST_TL_SLACK 2.0
+/** Fraction of the run time limit granted to the remote jobs before the local tick rate is known */
+#define DIST_PHASE_TL_FRAC 0.1
+/** Solve code of the Result answering a rejected job (not a CPLEX code) */
+#define DIST_JOB_REJECTED -2
+
+#pragma endregion
+
+namespace DistProtocol {
+
+	/**
+	 * @enum MsgType
+	 * @brief Kinds of messages exchanged by coordinator and workers.
+	 */
+	enum class MsgType : uint32_t {
+		Hello = 1, // Worker -> coordinator: instance name
+		Job,	   // Coordinator -> worker: JobMsg + reference and incumbent deltas
+		Result,	   // Worker -> coordinator: ResultMsg + solution delta
+		Stop	   // Coordinator -> worker: end of the run
+	};
+
+	/**
+	 * @struct MsgHeader
+	 * @brief Header of every message.
+	 */
+	struct MsgHeader {
+		uint32_t type; ///< MsgType
+		uint32_t pad;  ///< Unused (alignment)
+		uint64_t size; ///< Bytes of the payload
+	};
+
+	/**
+	 * @struct Delta
+	 * @brief Entry of a solution that changed.
+	 */
+	struct Delta {
+		uint64_t index; ///< Index of the variable
+		double	 value; ///< New value
+	};
+
+	/**
+	 * @struct JobMsg
+	 * @brief Neighborhood spec of a subMIP, followed by refDeltas + incDeltas Delta entries.
+	 */
+	struct JobMsg {
+		uint32_t phase;		///< DetBudget::Phase (FMIP or OMIP)
+		uint32_t policy;	///< PolicyPortfolio::Policy of the fixing
+		uint64_t seed;		///< Seed of the random draws of the fixing
+		uint64_t solSize;	///< Size of reference and incumbent
+		double	 rho;		///< Fraction of the variables to fix
+		double	 timeLimit; ///< Wall time (seconds) of the solve
+		double	 incSlack;	///< Slack sum of the incumbent
+		double	 incCost;	///< Objective cost of the incumbent
+		uint64_t refDeltas; ///< Delta entries of the reference solution
+		uint64_t incDeltas; ///< Delta entries of the incumbent
+	};
+
+	/**
+	 * @struct ResultMsg
+	 * @brief Outcome of a subMIP, followed by deltas Delta entries (against the reference).
+	 */
+	struct ResultMsg {
+		int32_t	 solveCode; ///< Code returned by the solve
+		uint32_t hasSol;	///< 1 if a solution follows
+		double	 slackSum;	///< Slack sum of the solution
+		double	 oMIPCost;	///< Objective cost of the solution
+		double	 ticks;		///< Deterministic ticks used
+		double	 solveTime; ///< Wall time of the solve
+		uint64_t solSize;	///< Size of the solution
+		uint64_t deltas;	///< Delta entries of the solution
+	};
+
+	/**
+	 * @class DistException
+	 * @brief Exception class for handling distributed-mode errors.
+	 */
+	class DistException : public ACSException {
+	public:
+		DistException(ExceptionType type, const std::string& message) : ACSException(type, message, "Distributed") {}
+	};
+}; // namespace DistProtocol
+
+/**
+ * @class DistCoordinator
+ * @brief Coordinator side of the distributed mode: dispatches subMIP specs and collects results.
+ *
+ * Used by the main thread only.
+ */
+class DistCoordinator {
+
+public:
+	/**
+	 * @struct RemoteResult
+	 * @brief Outcome of a remote subMIP.
+	 */
+	struct RemoteResult {
+		size_t					worker;		 ///< Index of the worker
+		PolicyPortfolio::Policy policy;		 ///< Fixing policy of the subMIP
+		int						solveCode;	 ///< Code returned by the solve
+		double					ticks;		 ///< Deterministic ticks used
+		double					solveTime;	 ///< Wall time of the solve
+		double					improvement; ///< Relative improvement over the incumbent at dispatch
+		bool					hasSol;		 ///< True if sol holds a solution
+	};
+
+	/**
+	 * @brief Opens the listening socket and waits (up to DIST_ACCEPT_TL seconds) for the workers.
+	 *
+	 * Workers running on a different instance are turned away.
+	 *
+	 * @param port TCP port to listen on.
+	 * @param numWorkers Number of worker processes expected.
+	 * @param fileName Instance of the run.
+	 */
+	DistCoordinator(unsigned long port, size_t numWorkers, const std::string& fileName);
+
+	/// Explicitly delete copy constructor and copy assignment operator
+	DistCoordinator(const DistCoordinator&) = delete;
+	DistCoordinator& operator=(const DistCoordinator&) = delete;
+
+	/**
+	 * @brief Sends a subMIP spec to every connected worker.
+	 *
+	 * @param phase Kind of subMIP (DetBudget::Phase::FMIP or DetBudget::Phase::OMIP).
+	 * @param refSol Solution the variables are fixed to (the broadcast solution).
+	 * @param incumbent Current incumbent.
+	 * @param rho Fraction of the variables to fix.
+	 * @param portfolio Bandit the fixing policies are drawn from.
+	 * @param rnd Random generator the seeds of the fixings are drawn from.
+	 * @param timeLimit Wall time (seconds) of the solves.
+	 */
+	void dispatch(DetBudget::Phase phase, const Solution& refSol, const Solution& incumbent, double rho, PolicyPortfolio& portfolio, Random& rnd, double timeLimit);
+
+	/**
+	 * @brief Waits for the results of the jobs dispatched and records them in the portfolio.
+	 *
+	 * Workers that do not answer within the time limit of the job plus DIST_GRACE_TL seconds
+	 * are dropped.
+	 *
+	 * @param portfolio Bandit the fixing policies have been drawn from.
+	 * @return Outcomes of the jobs (solutions in DistCoordinator::getSolutions).
+	 */
+	const std::vector<RemoteResult>& collect(PolicyPortfolio& portfolio);
+
+	/**
+	 * @brief Gets the solutions returned by the last collect.
+	 *
+	 * @return Vector of solutions (one per result with hasSol).
+	 */
+	[[nodiscard]]
+	inline const std::vector<Solution>& getSolutions() const noexcept { return solutions; }
+
+	/**
+	 * @brief Gets the number of workers still connected.
+	 *
+	 * @return Number of workers.
+	 */
+	[[nodiscard]]
+	size_t getNumWorkers() const;
+
+	/**
+	 * @brief Prints jobs and traffic of the run.
+	 */
+	void printStats() const;
+
+	/**
+	 * @brief Stops the workers and closes the sockets.
+	 */
+	~DistCoordinator();
+
+private:
+	/**
+	 * @struct RemoteWorker
+	 * @brief Connection and mirrored state of a worker.
+	 */
+	struct RemoteWorker {
+		int						fd;		   ///< Socket (-1 once dropped)
+		std::vector<double>		ref;	   ///< Reference solution as known by the worker
+		std::vector<double>		inc;	   ///< Incumbent as known by the worker
+		bool					busy;	   ///< True while a job is running
+		double					deadline;  ///< Time (Clock) after which the worker is dropped
+		DetBudget::Phase		phase;	   ///< Kind of the running job
+		PolicyPortfolio::Policy policy;	   ///< Fixing policy of the running job
+		Solution				refSol;	   ///< Incumbent objectives at dispatch (for the improvement)
+		size_t					jobs;	   ///< Jobs completed
+	};
+
+	int						  listenFD;	 ///< Listening socket
+	std::string				  fileName;	 ///< Instance of the run
+	std::vector<RemoteWorker> workers;	 ///< Connected workers
+	std::vector<RemoteResult> results;	 ///< Outcomes of the last collect
+	std::vector<Solution>	  solutions; ///< Solutions of the last collect
+	size_t					  bytesSent; ///< Bytes sent to the workers
+	size_t					  bytesRecv; ///< Bytes received from the workers
+
+	/**
+	 * @brief Closes the socket of a worker and removes it from the run.
+	 *
+	 * @param w Index of the worker.
+	 * @param reason Reason of the drop.
+	 */
+	void drop(size_t w, const char* reason);
+};
+
+/**
+ * @class DistWorker
+ * @brief Worker side of the distributed mode: solves the subMIPs the coordinator specifies.
+ */
+class DistWorker {
+
+public:
+	/**
+	 * @brief Connects to the coordinator (retrying up to DIST_CONNECT_TL seconds) and sends the instance name.
+	 *
+	 * @param CLIArgs The command-line arguments (file name, host, port and cores).
+	 */
+	DistWorker(Args& CLIArgs);
+
+	/// Explicitly delete copy constructor and copy assignment operator
+	DistWorker(const DistWorker&) = delete;
+	DistWorker& operator=(const DistWorker&) = delete;
+
+	/**
+	 * @brief Serves jobs until the coordinator stops the run, closes the connection or the
+	 *        time limit of the worker expires.
+	 *
+	 * @return Number of jobs solved.
+	 */
+	size_t run();
+
+	/**
+	 * @brief Closes the connection.
+	 */
+	~DistWorker();
+
+private:
+	Args&				CLIArgs; ///< Command-line arguments of the worker
+	int					fd;		 ///< Socket connected to the coordinator
+	std::vector<double> ref;	 ///< Reference solution (mirror of the coordinator copy)
+	std::vector<double> prevRef; ///< Reference solution of the previous job
+	std::vector<double> inc;	 ///< Incumbent (mirror of the coordinator copy)
+
+	/**
+	 * @brief Builds, fixes and solves the subMIP of a job, then sends the result.
+	 *
+	 * @param job Spec of the subMIP (ref and inc already updated).
+	 */
+	void solveJob(const DistProtocol::JobMsg& job);
+};
+
+#endif
@@ -0,0 +1,136 @@
+/**
+ * @file ElasticWorkers.hpp
+ * @brief This file defines the ElasticWorkers class, which chooses how many subMIPs
+ *        ACS solves concurrently in each parallel phase.
+ *
+ * The number of active workers of a phase (FMIP or OMIP) changes between rounds, within
+ * the worker slots allocated by MTContext: it doubles when the subMIPs of the last round
+ * ended before their time limit (cheap neighborhoods), it halves when most of them hit it
+ * (heavy neighborhoods, each gets more cores) or when the last growth lowered the improvement
+ * per second (that size is not tried again until the phase gets heavy). The non-zeros of all
+ * the concurrent subMIPs are kept under a budget.
+ *
+ * @author Francesco Biscaccia Carrara
+ * @version v1.2.11
+ * @since 15/09/2025
+ */
+
+#ifndef ELASTIC_WORKERS_H
+#define ELASTIC_WORKERS_H
+
+#include <mutex>
+
+#include "DetBudget.hpp"
+using namespace Utils;
+
+#pragma region ELASTIC_WORKERS_DEF
+
+/** Minimum number of active workers (recombination needs at least two solutions) */
+#define ELASTIC_MIN_WORKERS 2
+/** The phase grows if at most this fraction of its subMIPs hit the time limit */
+#define ELASTIC_GROW_FRAC 0.25
+/** The phase shrinks if at least this fraction of its subMIPs hit the time limit */
+#define ELASTIC_SHRINK_FRAC 0.75
+/** Maximum number of non-zeros of the subMIPs solved concurrently */
+#define ELASTIC_NNZ_BUDGET 5e8
+
+#pragma endregion
+
+/**
+ * @class ElasticWorkers
+ * @brief Controller of the number of concurrent subMIPs of each parallel phase.
+ *
+ * Workers record their solves concurrently (thread-safe), MTContext closes the round.
+ */
+class ElasticWorkers {
+
+public:
+	/**
+	 * @struct PhaseStats
+	 * @brief State and statistics of a parallel phase.
+	 */
+	struct PhaseStats {
+		size_t numActive;	///< Number of workers of the next round
+		size_t rounds;		///< Number of rounds closed
+		size_t sumActive;	///< Sum of the active workers over the rounds
+		size_t minActive;	///< Minimum number of active workers used
+		size_t maxActive;	///< Maximum number of active workers used
+		double lastRate;	///< Improvement per second of the last round
+		bool   lastGrow;	///< True if the last decision was a growth
+		size_t growCap;		///< Size a reverted growth cannot exceed anymore
+		size_t solves;		///< Solves recorded in the current round
+		size_t limits;		///< Solves of the current round ended by the time limit
+		double improvement; ///< Sum of the improvements of the current round
+		size_t nnz;			///< Non-zeros of the subMIPs of the current round
+	};
+
+	/**
+	 * @brief Constructs the controller.
+	 *
+	 * @param initWorkers Number of active workers of the first round.
+	 * @param maxWorkers Number of worker slots (upper bound of the active workers).
+	 * @param enabled If false the number of active workers never changes.
+	 */
+	ElasticWorkers(size_t initWorkers, size_t maxWorkers, bool enabled);
+
+	/// Explicitly delete copy constructor and copy assignment operator
+	ElasticWorkers(const ElasticWorkers&) = delete;
+	ElasticWorkers& operator=(const ElasticWorkers&) = delete;
+
+	/**
+	 * @brief Gets the number of workers of the next round of a phase.
+	 *
+	 * @param phase Kind of subMIP (DetBudget::Phase::FMIP or DetBudget::Phase::OMIP).
+	 * @return Number of active workers.
+	 */
+	[[nodiscard]]
+	size_t getNumActive(DetBudget::Phase phase);
+
+	/**
+	 * @brief Records the outcome of a subMIP of the current round.
+	 *
+	 * @param phase Kind of subMIP.
+	 * @param limitHit True if the solve was stopped by the time limit.
+	 * @param improvement Relative improvement obtained (see DetBudget::improvement).
+	 * @param nnz Number of non-zeros of the subMIP.
+	 */
+	void record(DetBudget::Phase phase, bool limitHit, double improvement, size_t nnz);
+
+	/**
+	 * @brief Closes the current round of a phase and decides the size of the next one.
+	 *
+	 * @param phase Kind of subMIP.
+	 * @param roundTime Length of the round: wall time in seconds (deterministic ticks in deterministic mode).
+	 * @return Number of active workers of the next round.
+	 */
+	size_t endRound(DetBudget::Phase phase, double roundTime);
+
+	/**
+	 * @brief Gets the statistics of a phase.
+	 * BE CAREFULL:: use only in a single-thread scenario!
+	 *
+	 * @param phase Kind of subMIP.
+	 * @return Statistics of the phase.
+	 */
+	[[nodiscard]]
+	inline const PhaseStats& getStats(DetBudget::Phase phase) { return stats[index(phase)]; }
+
+private:
+	/// Number of parallel phases (FMIP and OMIP, the first two DetBudget::Phase values)
+	static constexpr size_t NUM_PHASES{ 2 };
+
+	size_t							   maxWorkers; ///< Number of worker slots.
+	bool							   enabled;	   ///< Elasticity flag.
+	std::array<PhaseStats, NUM_PHASES> stats;	   ///< State of each phase.
+	std::mutex						   elasticMTX; ///< Mutex for synchronizing the statistics.
+
+	/**
+	 * @brief Index of a parallel phase.
+	 *
+	 * @param phase Kind of subMIP.
+	 * @return Index in the stats array.
+	 */
+	static size_t index(DetBudget::Phase phase);
+};
+
+#endif
@@ -0,0 +1,181 @@
+/**
+ * @file ElitePool.hpp
+ * @brief This file defines the ElitePool class, a bounded pool of distinct good solutions
+ *        found by ACS (worker results, merge results, starting vectors).
+ *
+ * Every offered solution is identified by a 64-bit hash of its values: a solution already
+ * seen is counted as duplicate and dropped, so the pool never holds two copies and the rate
+ * of duplicate worker results is known. When the pool is full, a new solution replaces the
+ * member closest to it (Hamming distance on the integer variables) among the members it
+ * beats: good solutions that are far from the others survive. The pool feeds the
+ * recombinations and the starting solutions of part of the workers.
+ *
+ * @author Francesco Biscaccia Carrara
+ * @version v1.2.11
+ * @since 15/09/2025
+ */
+
+#ifndef ELITE_POOL_H
+#define ELITE_POOL_H
+
+#include <mutex>
+#include <unordered_set>
+
+#include "MIP.hpp"
+using namespace Utils;
+
+#pragma region ELITE_POOL_DEF
+
+/** Grid on which the values are rounded before hashing */
+#define ELITE_HASH_GRID 1e-6
+/** Elite members (the best ones) added to the solutions of each recombination */
+#define ELITE_MERGE_SOLS 2
+/** One worker slot every ELITE_START_STRIDE starts from an elite member instead of the broadcast solution */
+#define ELITE_START_STRIDE 4
+
+#pragma endregion
+
+/**
+ * @class ElitePool
+ * @brief Bounded, deduplicated and diversity-aware pool of solutions.
+ *
+ * Solutions are offered concurrently by the workers (thread-safe); the getters of the
+ * statistics are meant for a single-thread scenario.
+ */
+class ElitePool {
+
+public:
+	/**
+	 * @struct Stats
+	 * @brief Outcome of the solutions offered to the pool.
+	 */
+	struct Stats {
+		size_t offered;	   ///< Solutions offered
+		size_t duplicates; ///< Offered solutions already seen
+		size_t inserted;   ///< Solutions that entered the pool
+		size_t evicted;	   ///< Members replaced by a better solution
+		size_t rejected;   ///< New solutions not better than any member of the full pool
+	};
+
+	/**
+	 * @brief Constructs the pool.
+	 *
+	 * @param capacity Maximum number of members (0: the pool is off and ignores every solution).
+	 */
+	ElitePool(size_t capacity);
+
+	/// Explicitly delete copy constructor and copy assignment operator
+	ElitePool(const ElitePool&) = delete;
+	ElitePool& operator=(const ElitePool&) = delete;
+
+	/**
+	 * @brief Reads the variable types of the instance: distances are then measured on the integer
+	 *        variables and hashes on the MIP variables only (slack columns excluded).
+	 *
+	 * @param fileName Name of the instance.
+	 */
+	void loadVarTypes(const std::string& fileName);
+
+	/**
+	 * @brief Checks whether the pool is on.
+	 *
+	 * @return True if the capacity is positive.
+	 */
+	[[nodiscard]]
+	inline bool isEnabled() const noexcept { return capacity > 0; }
+
+	/**
+	 * @brief Offers a solution to the pool.
+	 *
+	 * @param sol The solution.
+	 * @return True if the solution entered the pool.
+	 */
+	bool insert(const Solution& sol);
+
+	/**
+	 * @brief Computes the hash of a solution.
+	 *
+	 * @param sol The solution.
+	 * @return 64-bit hash (FNV-1a) of the values rounded on ELITE_HASH_GRID.
+	 */
+	[[nodiscard]]
+	uint64_t hash(const Solution& sol) const;
+
+	/**
+	 * @brief Gets the best members.
+	 *
+	 * @param k Maximum number of members.
+	 * @return Up to k members, best first.
+	 */
+	[[nodiscard]]
+	std::vector<Solution> getBest(size_t k);
+
+	/**
+	 * @brief Gets the members farthest from a solution.
+	 *
+	 * @param ref The reference solution.
+	 * @param k Maximum number of members.
+	 * @return Up to k members different from ref, farthest first.
+	 */
+	[[nodiscard]]
+	std::vector<Solution> getFarthest(const Solution& ref, size_t k);
+
+	/**
+	 * @brief Gets the number of members.
+	 *
+	 * @return Size of the pool.
+	 */
+	[[nodiscard]]
+	size_t getSize();
+
+	/**
+	 * @brief Gets the statistics of the pool.
+	 * BE CAREFULL:: use only in a single-thread scenario!
+	 *
+	 * @return Statistics of the offered solutions.
+	 */
+	[[nodiscard]]
+	inline const Stats& getStats() const noexcept { return stats; }
+
+	~ElitePool() = default;
+
+private:
+	/**
+	 * @struct Member
+	 * @brief Solution of the pool with its hash.
+	 */
+	struct Member {
+		Solution sol;  ///< The solution
+		uint64_t hash; ///< Hash of the solution
+	};
+
+	size_t						 capacity; ///< Maximum number of members
+	size_t						 numVars;  ///< MIP variables (0: the whole vector is hashed)
+	std::vector<int>			 intVars;  ///< Integer variables (empty: distances on all the variables)
+	std::vector<Member>			 members;  ///< Members of the pool
+	std::unordered_set<uint64_t> seen;	   ///< Hashes of all the offered solutions
+	Stats						 stats;	   ///< Statistics of the offered solutions
+	std::mutex					 poolMTX;  ///< Mutex for synchronizing the offers
+
+	/**
+	 * @brief Compares two solutions: lower slack sum first, then lower cost.
+	 *
+	 * @param a First solution.
+	 * @param b Second solution.
+	 * @return True if a is better than b.
+	 */
+	[[nodiscard]]
+	static bool isBetter(const Solution& a, const Solution& b);
+
+	/**
+	 * @brief Hamming distance between two solutions on the integer variables.
+	 *
+	 * @param a First solution.
+	 * @param b Second solution.
+	 * @return Number of integer variables taking different values.
+	 */
+	[[nodiscard]]
+	size_t distance(const Solution& a, const Solution& b) const;
+};
+
+#endif
@@ -0,0 +1,191 @@
+/**
+ * @file FeasJump.hpp
+ * @brief This file defines the FeasJump class, a multithreaded weighted local search
+ *        (in the spirit of Feasibility Jump) run before the first FMIP phase.
+ *
+ * Each walker thread moves one variable at a time to its "jump" value: the value that
+ * minimizes the weighted violation of the constraints of the variable, all the others
+ * being fixed. Row activities are updated incrementally on the shared CSR of the MIP
+ * (plus a CSC copy built once); when no move improves, the weights of the violated
+ * constraints grow. No CPLEX call is made: the best (lowest violation) assignments of
+ * the walkers seed the first ACS phase, and a walker reaching violation zero ends the
+ * search with a feasible point.
+ *
+ * @author Francesco Biscaccia Carrara
+ * @version v1.2.11
+ * @since 15/09/2025
+ */
+
+#ifndef FEAS_JUMP_H
+#define FEAS_JUMP_H
+
+#include <atomic>
+
+#include "MIP.hpp"
+using namespace Utils;
+
+#pragma region FEAS_JUMP_DEF
+
+/** Violation below which a constraint is satisfied */
+#define FJ_FEAS_TOL 1e-6
+/** Violated constraints whose variables are scored at each step */
+#define FJ_SAMPLE_ROWS 4
+/** Maximum variables scored per sampled constraint */
+#define FJ_SAMPLE_VARS 32
+/** Weight added to the violated constraints when no move improves */
+#define FJ_WEIGHT_INC 1.0
+/** Steps between two checks of the time limit */
+#define FJ_CHECK_STEPS 1024
+/** Steps per second of slice granted to each walker in deterministic mode */
+#define FJ_DET_STEPS_PER_SEC 1e6
+
+#pragma endregion
+
+/**
+ * @class FeasJump
+ * @brief Weighted local search for feasible assignments of the original MIP.
+ */
+class FeasJump {
+
+public:
+	/**
+	 * @brief Loads bounds, types and objective of the instance and builds the CSC of the constraint matrix.
+	 *
+	 * @param fileName Name of the instance.
+	 */
+	FeasJump(const std::string& fileName);
+
+	/// Explicitly delete copy constructor and copy assignment operator
+	FeasJump(const FeasJump&) = delete;
+	FeasJump& operator=(const FeasJump&) = delete;
+
+	/**
+	 * @brief Runs the walkers from a starting vector.
+	 *
+	 * Walkers stop at the time limit, when one of them finds a feasible assignment or,
+	 * in deterministic mode, after timeLimit * FJ_DET_STEPS_PER_SEC steps each (no early stop).
+	 *
+	 * @param starts Starting vectors (MIP variables): walker i starts from starts[i % starts.size()].
+	 * @param numWalkers Number of walker threads.
+	 * @param timeLimit Wall time (seconds) of the search.
+	 * @param seed Seed of the walkers (walker i uses seed + i + 1).
+	 * @param deterministic If true the search depends on the seed only.
+	 * @return Best assignment of each walker, lowest violation first, with the slack columns of
+	 *         the FMIP/OMIP models (SP, SN) set: slackSum is the violation, oMIPCost the objective.
+	 */
+	std::vector<Solution> run(const std::vector<std::vector<double>>& starts, size_t numWalkers, double timeLimit, unsigned long long seed, bool deterministic = false);
+
+	/**
+	 * @brief Completes an assignment of the MIP variables with the slack columns of the FMIP/OMIP models.
+	 *
+	 * @param x Assignment (MIP variables).
+	 * @return Solution with SP and SN set: slackSum is the violation, oMIPCost the objective.
+	 */
+	[[nodiscard]]
+	Solution evaluate(const std::vector<double>& x) const;
+
+	/**
+	 * @brief Gets the number of moves of the last run (all the walkers).
+	 *
+	 * @return Number of moves.
+	 */
+	[[nodiscard]]
+	inline size_t getNumMoves() const noexcept { return A_Moves; }
+
+	/**
+	 * @brief Gets the number of weight updates of the last run (all the walkers).
+	 *
+	 * @return Number of weight updates.
+	 */
+	[[nodiscard]]
+	inline size_t getNumWeightUpdates() const noexcept { return A_WeightUpdates; }
+
+	~FeasJump() = default;
+
+private:
+	/**
+	 * @struct Breakpoint
+	 * @brief Point where the slope of the weighted violation of a variable changes.
+	 */
+	struct Breakpoint {
+		double value; ///< Value of the variable
+		double slope; ///< Slope change
+	};
+
+	size_t					   numVars; ///< Number of MIP variables
+	size_t					   numRows; ///< Number of constraints
+	const std::vector<int>&	   rowBeg;	///< CSR row starts (shared MIP data)
+	const std::vector<int>&	   rowInd;	///< CSR column indices (shared MIP data)
+	const std::vector<double>& rowVal;	///< CSR values (shared MIP data)
+	const std::vector<char>&   sense;	///< Constraint senses (shared MIP data)
+	const std::vector<double>& rhs;		///< Right-hand sides (shared MIP data)
+	std::vector<int>		   colBeg;	///< CSC column starts (numVars + 1 entries)
+	std::vector<int>		   colRow;	///< CSC row indices
+	std::vector<double>		   colVal;	///< CSC values
+	std::vector<double>		   lb;		///< Lower bounds
+	std::vector<double>		   ub;		///< Upper bounds
+	std::vector<char>		   isInt;	///< 1 for binary and integer variables
+	std::vector<double>		   obj;		///< Objective coefficients
+
+	std::atomic_bool   A_Feasible{ false };	 ///< Set by the first walker reaching violation zero
+	std::atomic_size_t A_Moves{ 0 };		 ///< Moves of the last run
+	std::atomic_size_t A_WeightUpdates{ 0 }; ///< Weight updates of the last run
+
+	/**
+	 * @brief Reads the data of the instance from a model of it.
+	 *
+	 * @param model The MIP (only used during construction).
+	 */
+	FeasJump(MIP&& model);
+
+	/**
+	 * @brief Violation of a constraint at a given activity.
+	 *
+	 * @param c Index of the constraint.
+	 * @param act Activity of the constraint.
+	 * @return Violation (0 if satisfied).
+	 */
+	[[nodiscard]]
+	double rowViol(const size_t c, const double act) const;
+
+	/**
+	 * @brief Computes the jump value of a variable: the value minimizing the weighted violation
+	 *        of its constraints (convex, piecewise linear), the other variables being fixed.
+	 *
+	 * @param j Index of the variable.
+	 * @param x Current assignment.
+	 * @param act Current row activities.
+	 * @param weight Constraint weights.
+	 * @param bps Scratch buffer of the walker.
+	 * @param gain Decrease of the weighted violation of the move (output).
+	 * @return Jump value.
+	 */
+	double jumpValue(const size_t j, const std::vector<double>& x, const std::vector<double>& act, const std::vector<double>& weight, std::vector<Breakpoint>& bps, double& gain) const;
+
+	/**
+	 * @brief Weighted violation of the constraints of a variable at a given value.
+	 *
+	 * @param j Index of the variable.
+	 * @param v Value of the variable.
+	 * @param x Current assignment.
+	 * @param act Current row activities.
+	 * @param weight Constraint weights.
+	 * @return Weighted violation.
+	 */
+	[[nodiscard]]
+	double weightedViol(const size_t j, const double v, const std::vector<double>& x, const std::vector<double>& act, const std::vector<double>& weight) const;
+
+	/**
+	 * @brief Local search of a walker.
+	 *
+	 * @param start Starting vector.
+	 * @param deadline Time (Clock) at which the walker stops (CPX_INFBOUND: deterministic walk,
+	 *                 no time limit and no early stop).
+	 * @param maxSteps Maximum steps of the walker.
+	 * @param rnd Random number generator of the walker.
+	 * @param best Best assignment found (output).
+	 */
+	void walk(const std::vector<double>& start, const double deadline, const size_t maxSteps, Random& rnd, Solution& best);
+};
+
+#endif
@@ -28,6 +28,51 @@ using namespace Utils;
 
 #pragma endregion
 
+#pragma region GRAPH_FIX_DEF
+/** Consecutive random-walk steps without new free variables before a restart */
+#define GRAPH_WALK_MAX_STUCK 64
+
+#pragma endregion
+
+#pragma region START_POOL_DEF
+/** Fraction of the time limit granted to each startSolTheta of the pool */
+#define START_POOL_TL_FRAC 0.05
+/** Range of the theta values of the startSolTheta vectors of the pool */
+#define START_POOL_MIN_THETA 0.2
+#define START_POOL_MAX_THETA 0.8
+
+#pragma endregion
+
+#pragma region LP_FIX_DEF
+/** Fraction of the time limit granted to the root LP */
+#define ROOT_LP_TL_FRAC 0.1
+/** Maximum relative perturbation of the reduced costs (diversifies FixPolicy::redCostFixMT) */
+#define REDCOST_NOISE 0.5
+
+#pragma endregion
+
+#pragma region BLOCK_DEF
+/** Rows longer than BLOCK_LINK_FACTOR times the mean row length are linking rows */
+#define BLOCK_LINK_FACTOR 4.0
+/** Maximum fraction of the rows removed as linking rows */
+#define BLOCK_MAX_LINK_FRAC 0.05
+/** Maximum number of blocks (smaller components are packed together) */
+#define BLOCK_MAX_BLOCKS 32
+/** Maximum share of the variables in the largest block for the decomposition to be used */
+#define BLOCK_MAX_SHARE 0.9
+
+#pragma endregion
+
+#pragma region LOCAL_BRANCH_DEF
+/** Local branching radius, as a fraction of the binaries rho-fixing would leave free */
+#define LOCAL_BRANCH_K_FRAC 0.1
+/** Minimum local branching radius */
+#define LOCAL_BRANCH_MIN_K 10
+/** Sense of the local branching row */
+#define LOCAL_BRANCH_SENSE 'L'
+
+#pragma endregion
+
 #pragma region DYN_ADJUST_RHO_DEF
 /** Clamping value for fixing */
 #define MAX_UB 1e6
@@ -56,15 +101,51 @@ namespace FixPolicy {
 		FixPolicyException(ExceptionType type, const std::string& message) : ACSException(type, message, "FixPolicy") {}
 	};
 
-	void startSolTheta(std::vector<double>& sol, std::string fileName, double theta, double timelimit, Random& rnd);
+	/**
+	 * @struct RootLP
+	 * @brief LP relaxation of the original MIP, solved once and shared read-only by the workers.
+	 */
+	struct RootLP {
+		std::vector<double> x;		  ///< Optimal LP solution (empty if not available)
+		std::vector<double> redCosts; ///< Reduced costs at the optimum
+		double				objValue; ///< Optimal LP value
+	};
+
+	/**
+	 * @struct Blocks
+	 * @brief Block structure of the original MIP: the connected components of the variable-constraint
+	 *        graph without the linking rows, packed into at most BLOCK_MAX_BLOCKS blocks.
+	 */
+	struct Blocks {
+		std::vector<std::vector<int>> vars;		///< Variables of each block, in increasing order (empty if no decomposition)
+		std::vector<int>			  varBlock; ///< Block of each variable
+		size_t						  numLinks; ///< Linking rows removed
+		size_t						  numComps; ///< Connected components found
+	};
+
+	void startSolTheta(std::vector<double>& sol, std::string fileName, double theta, double timelimit, Random& rnd, bool walkMIPRef = true);
 
 	/**
 	 * @brief Modifies the sol vector to obtain a starting solution for FMIP optimization.
 	 * @param sol Vector of double values to be updated.
 	 * @param fileName Name of the file used to build the RelaxedFMIP object.
 	 * @param rnd Random number generator instance.
+	 * @param walkMIPRef Whether the vector sets the reference number of violated constraints of walkMIPMT.
 	 */
-	void startSolMaxFeas(std::vector<double>& sol, std::string fileName, Random& rnd);
+	void startSolMaxFeas(std::vector<double>& sol, std::string fileName, Random& rnd, bool walkMIPRef = true);
+
+	/**
+	 * @brief Builds numSols diverse starting vectors in parallel (one thread each): even slots run
+	 *        startSolMaxFeas with their own tie-break seed, odd slots startSolTheta with thetas spread in
+	 *        [START_POOL_MIN_THETA, START_POOL_MAX_THETA] (MaxFeas if the LP dive fails). Only slot 0
+	 *        sets the reference of walkMIPMT, so that it does not depend on the thread schedule.
+	 * @param fileName Name of the instance.
+	 * @param numSols Number of vectors.
+	 * @param timeLimit Time limit of the run (each dive gets START_POOL_TL_FRAC of it).
+	 * @param seed Seed of the vectors (slot i uses seed + i + 1).
+	 * @return The starting vectors (MIP variables).
+	 */
+	std::vector<std::vector<double>> startSolPool(std::string fileName, size_t numSols, double timeLimit, unsigned long long seed);
 
 	void walkMIPMT(const size_t threadID, const char* type, MIP& model, const std::vector<double>& sol, double rho, double p, Random& rnd);
 
@@ -73,7 +154,8 @@ namespace FixPolicy {
 	void fixSlackUpperBound(const char* type, MIP& model, const std::vector<double>& sol);
 
 	/**
-	 * @brief Modifies the rho parameter in the given model based on a solution vector.
+	 * @brief Modifies the rho parameter in the given model based on a solution vector: fixes a contiguous
+	 *        window of a fraction rho of the integer variables (see FixPolicy::setContinuousRho).
 	 * @param threadID ID of the thread executing this function.
 	 * @param type Type of subMIP applied.
 	 * @param model Reference to the MIP model being modified.
@@ -84,25 +166,133 @@ namespace FixPolicy {
 	void randomRhoFixMT(const size_t threadID, const char* type, MIP& model, const std::vector<double>& sol, double rho, Random& rnd);
 
 	/**
-	 * @brief Adjusts Rho parameter dynamically to speed up ACS (in the recombination phases).
-	 * @param phase String that define the phase.
-	 * @param solveCode Code returned by CPXmipopt.
-	 * @param numMIPs Number of logical sub-MIPs executing in parallel.
-	 * @param CLIRho Reference rho value in the CLI args.
-	 * @param A_RhoChanges Value of atomic size_t var used to handle adjustment.
+	 * @brief Fixes a fraction rho of the integer variables, drawn uniformly at random (not a contiguous window).
+	 * @param threadID ID of the thread executing this function.
+	 * @param type Type of subMIP applied.
+	 * @param model Reference to the MIP model being modified.
+	 * @param sol The solution vector.
+	 * @param rho Rho parameter value.
+	 * @param rnd Random number generator instance.
+	 */
+	void uniformRhoFixMT(const size_t threadID, const char* type, MIP& model, const std::vector<double>& sol, double rho, Random& rnd);
+
+	/**
+	 * @brief Fixes a fraction rho of the integer variables, leaving free a connected set found by BFS on the
+	 *        variable-constraint graph, from the violated constraints of sol (or, if none, from the
+	 *        variables that changed since prevSol).
+	 * @param threadID ID of the thread executing this function.
+	 * @param type Type of subMIP applied.
+	 * @param model Reference to the MIP model being modified.
+	 * @param sol The solution vector.
+	 * @param prevSol Previous reference solution (may be empty).
+	 * @param rho Rho parameter value.
+	 * @param rnd Random number generator instance.
 	 */
-	void dynamicAdjustRho(const char* phase, const int solveCode, const size_t numMIPs, double& CLIRho, const size_t A_RhoChanges);
+	void graphBFSFixMT(const size_t threadID, const char* type, MIP& model, const std::vector<double>& sol, const std::vector<double>& prevSol, double rho, Random& rnd);
 
 	/**
-	 * @brief Adjust Rho parameter to speed up ACS (multi-threading scenario).
+	 * @brief As FixPolicy::graphBFSFixMT, but the free set is grown by random walks on the
+	 *        variable-constraint graph (restarted from the seeds when stuck).
 	 * @param threadID ID of the thread executing this function.
-	 * @param type String that define which type of subMIP is modifing rho.
-	 * @param solveCode Code returned by CPXmipopt
-	 * @param numMIPs Number of logical sub-MIPs executing in parallel.
-	 * @param CLIRho Reference rho value in the CLI args.
-	 * @param A_RhoChanges Reference to a atomic size_t var used to handle adjustment.
+	 * @param type Type of subMIP applied.
+	 * @param model Reference to the MIP model being modified.
+	 * @param sol The solution vector.
+	 * @param prevSol Previous reference solution (may be empty).
+	 * @param rho Rho parameter value.
+	 * @param rnd Random number generator instance.
+	 */
+	void graphWalkFixMT(const size_t threadID, const char* type, MIP& model, const std::vector<double>& sol, const std::vector<double>& prevSol, double rho, Random& rnd);
+
+	/**
+	 * @brief Solves the root LP relaxation of the original MIP and caches solution and reduced costs.
+	 *        Only the first call solves the LP: later calls (from any thread) return at once.
+	 * @param fileName Name of the instance.
+	 * @param timeLimit Wall time (seconds) granted to the LP.
+	 */
+	void solveRootLP(std::string fileName, double timeLimit);
+
+	/**
+	 * @brief Gets the cached root LP (FixPolicy::solveRootLP).
+	 * @return Reference to the root LP (x empty if not solved or not optimal).
+	 */
+	[[nodiscard]]
+	const RootLP& getRootLP();
+
+	/**
+	 * @brief RINS-style fixing: fixes a fraction rho of the integer variables, first among those whose value in sol
+	 *        agrees with the root LP, then the ones closest to it.
+	 * @param threadID ID of the thread executing this function.
+	 * @param type Type of subMIP applied.
+	 * @param model Reference to the MIP model being modified.
+	 * @param sol The solution vector.
+	 * @param rho Rho parameter value.
+	 * @param rnd Random number generator instance.
+	 */
+	void rinsFixMT(const size_t threadID, const char* type, MIP& model, const std::vector<double>& sol, double rho, Random& rnd);
+
+	/**
+	 * @brief Fixes a fraction rho of the integer variables, those with the largest root LP reduced costs
+	 *        (randomly perturbed by up to REDCOST_NOISE).
+	 * @param threadID ID of the thread executing this function.
+	 * @param type Type of subMIP applied.
+	 * @param model Reference to the MIP model being modified.
+	 * @param sol The solution vector.
+	 * @param rho Rho parameter value.
+	 * @param rnd Random number generator instance.
+	 */
+	void redCostFixMT(const size_t threadID, const char* type, MIP& model, const std::vector<double>& sol, double rho, Random& rnd);
+
+	/**
+	 * @brief Detects the block structure of the original MIP and caches it: rows longer than BLOCK_LINK_FACTOR
+	 *        times the mean (at most BLOCK_MAX_LINK_FRAC of the rows) are linking rows, the connected components
+	 *        of the remaining graph are packed, largest first, into the smallest of at most BLOCK_MAX_BLOCKS blocks.
+	 *        No decomposition is kept with less than two blocks or a block holding over BLOCK_MAX_SHARE of the
+	 *        variables. Only the first call detects the blocks: later calls (from any thread) return at once.
+	 * @param fileName Name of the instance.
+	 */
+	void detectBlocks(std::string fileName);
+
+	/**
+	 * @brief Gets the cached block structure (FixPolicy::detectBlocks).
+	 * @return Reference to the blocks (vars empty if not detected or not decomposable).
+	 */
+	[[nodiscard]]
+	const Blocks& getBlocks();
+
+	/**
+	 * @brief Block fixing: frees the integer variables of one block and fixes all the others; if the block
+	 *        holds more than a fraction 1-rho of the integer variables, a window of it is fixed as well.
+	 * @param threadID ID of the thread executing this function.
+	 * @param type Type of subMIP applied.
+	 * @param model Reference to the MIP model being modified.
+	 * @param sol The solution vector.
+	 * @param block Index of the block left free (see FixPolicy::getBlocks).
+	 * @param rho Rho parameter value.
+	 * @param rnd Random number generator instance.
+	 */
+	void blockFixMT(const size_t threadID, const char* type, MIP& model, const std::vector<double>& sol, size_t block, double rho, Random& rnd);
+
+	/**
+	 * @brief Local branching: no variable is fixed, a single row bounds by k the Hamming distance of the
+	 *        binaries from sol, with k = max(LOCAL_BRANCH_MIN_K, LOCAL_BRANCH_K_FRAC * (1 - rho) * #binaries),
+	 *        so that k follows the rho of the worker. The row is recorded by the bound journal of the model
+	 *        (MIP::addRow), which removes it on restore. Falls back to randomRhoFixMT without binaries.
+	 * @param threadID ID of the thread executing this function.
+	 * @param type Type of subMIP applied.
+	 * @param model Reference to the MIP model being modified.
+	 * @param sol The solution vector.
+	 * @param rho Rho parameter value.
+	 * @param rnd Random number generator instance.
+	 */
+	void localBranchMT(const size_t threadID, const char* type, MIP& model, const std::vector<double>& sol, double rho, Random& rnd);
+
+	/**
+	 * @brief Sets the fraction of the continuous variables fixed by the subMIP fixing policies, whose rho
+	 *        applies to the integer variables only (continuous variables let the rows absorb the changes).
+	 *        Call it before the workers start.
+	 * @param rho Fraction of the continuous variables to fix, within [0,1) (0: all left free).
 	 */
-	void dynamicAdjustRhoMT(const size_t threadID, const char* type, const int solveCode, const size_t numMIPs, double& CLIRho, std::atomic_size_t& A_RhoChanges);
+	void setContinuousRho(double rho);
 }; // namespace FixPolicy
 
 #endif
\ No newline at end of file
@@ -0,0 +1,340 @@
+/**
+ * @file IteratedRace.hpp
+ * @brief This file defines the IteratedRace class, an iterated racing procedure (in the style of
+ *        irace) that tunes the ACS parameters over a set of instances and seeds.
+ *
+ * Each iteration samples new configurations around the elites of the previous one (uniformly at
+ * the first), then races them: the surviving configurations are run on one more block (instance
+ * and seed) at a time and, from RACE_FIRST_TEST blocks on, a Friedman test on the per-block ranks
+ * of the scores is followed by the Conover post-hoc comparison with the best rank sum, which
+ * discards the configurations significantly worse than it. A race ends when few configurations
+ * survive or the budget of the iteration is spent. Results are cached per configuration and
+ * block: a race starts with RACE_NEW_BLOCKS unseen blocks, then replays the blocks of the previous
+ * races, on which the elites are not run again.
+ *
+ * The runs are delegated to an evaluator (see Tuner.cpp), called by up to numWorkers threads
+ * at once: it must be thread-safe.
+ *
+ * @author Francesco Biscaccia Carrara
+ * @version v1.2.11
+ * @since 15/09/2025
+ */
+
+#ifndef ITERATED_RACE_H
+#define ITERATED_RACE_H
+
+#include <functional>
+#include <map>
+
+#include "Utils.hpp"
+using namespace Utils;
+
+#pragma region RACE_DEF
+
+/** Blocks (instance and seed) every configuration of a race runs before the first test */
+#define RACE_FIRST_TEST 5
+/** New blocks a race starts with, before the ones the elites have already run */
+#define RACE_NEW_BLOCKS 1
+/** Blocks between two statistical tests */
+#define RACE_EACH_TEST 1
+/** Significance level of the Friedman test and of its post-hoc comparisons */
+#define RACE_ALPHA 0.05
+/** Minimum number of configurations raced in an iteration */
+#define RACE_MIN_CONFIGS 4
+/** Initial standard deviation of the numerical parameters (fraction of their range) */
+#define RACE_SD_INIT 0.5
+/** Tries to draw a numerical value within its range before clamping it */
+#define RACE_SAMPLE_TRIES 10
+/** Default parameter space: <name> <ACS flag> <r(eal)|i(nteger)|c(ategorical)> <min> <max> | <choices...> */
+#define RACE_DEFAULT_SPACE { "rho -rh r 0.05 0.9", "numsubMIPs -nSMIPs i 1 16", "walkProb -pb r 0.05 0.9", "detScale -ds r 0.25 4.0", "fixPolicy -fx c 0 1 2 3 4 5 6 7 8" }
+
+#pragma endregion
+
+/**
+ * @class IteratedRace
+ * @brief Iterated racing over a parameter space, an instance set and seeds.
+ *
+ * Used by the main thread only: the worker threads only call the evaluator.
+ */
+class IteratedRace {
+
+public:
+	/**
+	 * @struct Param
+	 * @brief Tuned parameter.
+	 */
+	struct Param {
+		std::string			name;	///< Name of the parameter
+		std::string			flag;	///< ACS CLI flag setting it
+		char				type;	///< 'r' real, 'i' integer, 'c' categorical
+		std::vector<double> values; ///< {min, max} for 'r' and 'i', the choices for 'c'
+	};
+
+	/**
+	 * @struct Instance
+	 * @brief Tuning instance.
+	 */
+	struct Instance {
+		std::string name;	   ///< Name of the instance (as -f)
+		double		objective; ///< Reference objective (NaN if unknown)
+	};
+
+	/**
+	 * @struct Config
+	 * @brief Candidate configuration.
+	 */
+	struct Config {
+		size_t				id;		   ///< Index of the configuration (also the -ag label of its runs)
+		size_t				parent;	   ///< Elite it has been sampled around (its own id at the first iteration)
+		size_t				iteration; ///< Iteration the configuration has been sampled in
+		std::vector<double> values;	   ///< Value of each parameter
+	};
+
+	/**
+	 * @struct Block
+	 * @brief Instance and seed of a column of the race.
+	 */
+	struct Block {
+		size_t			   instance; ///< Index of the instance
+		unsigned long long seed;	 ///< ACS seed
+	};
+
+	/**
+	 * @struct Result
+	 * @brief Outcome of a run (filled by the evaluator).
+	 */
+	struct Result {
+		bool   feasible; ///< True if a feasible solution has been found
+		double cost;	 ///< Objective cost of the solution (NaN if none)
+		double gap;		 ///< Primal gap with the reference objective (1 if no solution)
+		double time;	 ///< Wall time of the run
+		double score;	 ///< Value ranked by the race (lower is better)
+	};
+
+	/**
+	 * @struct Run
+	 * @brief Entry of the race log.
+	 */
+	struct Run {
+		size_t config; ///< Index of the configuration
+		size_t block;  ///< Index of the block
+		Result result; ///< Outcome of the run
+	};
+
+	/**
+	 * @struct Test
+	 * @brief Statistical test of a race.
+	 */
+	struct Test {
+		size_t				iteration;	///< Iteration of the race
+		std::vector<size_t> blocks;		///< Blocks compared
+		std::vector<size_t> alive;		///< Configurations compared
+		double				statistic;	///< Friedman statistic
+		double				pValue;		///< P-value of the Friedman test
+		std::vector<size_t> eliminated; ///< Configurations discarded by the post-hoc comparisons
+	};
+
+	/// Runs a configuration on an instance with a seed
+	using Evaluator = std::function<Result(const Config& config, const Instance& instance, unsigned long long seed)>;
+
+	/**
+	 * @brief Prepares the race (no run is started).
+	 *
+	 * @param space Tuned parameters.
+	 * @param instances Tuning instances.
+	 * @param budget Total number of runs.
+	 * @param numWorkers Maximum number of concurrent runs.
+	 * @param seed Seed of the sampling, of the instance order and of the ACS seeds.
+	 * @param evaluator Thread-safe function running a configuration.
+	 */
+	IteratedRace(std::vector<Param> space, std::vector<Instance> instances, size_t budget, size_t numWorkers, unsigned long long seed, Evaluator evaluator);
+
+	/// Explicitly delete copy constructor and copy assignment operator
+	IteratedRace(const IteratedRace&) = delete;
+	IteratedRace& operator=(const IteratedRace&) = delete;
+
+	/**
+	 * @brief Runs the iterations until the budget is spent (more than getNumIterations() if the races
+	 *        end early).
+	 *
+	 * @return The best elite of the last race.
+	 */
+	const Config& run();
+
+	/**
+	 * @brief Mean score of a configuration over the blocks it has run.
+	 *
+	 * @param config Index of the configuration.
+	 * @return Mean score (NaN if it has no run).
+	 */
+	[[nodiscard]]
+	double meanScore(size_t config) const;
+
+	/**
+	 * @brief Number of runs of a configuration (one per block).
+	 *
+	 * @param config Index of the configuration.
+	 * @return Number of blocks.
+	 */
+	[[nodiscard]]
+	size_t numRuns(size_t config) const;
+
+	[[nodiscard]]
+	inline const std::vector<Param>& getSpace() const { return space; }
+
+	[[nodiscard]]
+	inline const std::vector<Instance>& getInstances() const { return instances; }
+
+	[[nodiscard]]
+	inline const std::vector<Config>& getConfigs() const { return configs; }
+
+	[[nodiscard]]
+	inline const std::vector<Block>& getBlocks() const { return blocks; }
+
+	[[nodiscard]]
+	inline const std::vector<Run>& getRuns() const { return runs; }
+
+	[[nodiscard]]
+	inline const std::vector<Test>& getTests() const { return tests; }
+
+	/**
+	 * @brief Gets the elites of the last race, best first.
+	 *
+	 * @return Indices of the elite configurations.
+	 */
+	[[nodiscard]]
+	inline const std::vector<size_t>& getElites() const { return elites; }
+
+	/**
+	 * @brief Gets the number of iterations of the budget.
+	 *
+	 * @return Number of iterations (2 + log2 of the number of parameters).
+	 */
+	[[nodiscard]]
+	inline size_t getNumIterations() const { return numIterations; }
+
+	/**
+	 * @brief Reads a parameter space, one parameter per line (see RACE_DEFAULT_SPACE).
+	 *
+	 * @param fileName Path of the file (empty: RACE_DEFAULT_SPACE).
+	 * @return Parameters.
+	 * @throws RaceException if the file cannot be read or a line is malformed.
+	 */
+	static std::vector<Param> loadSpace(const std::string& fileName);
+
+	/**
+	 * @brief Reads an instance list (CSV with header, name in the first column, reference objective
+	 *        in the second, possibly empty), such as fHard_instances.csv.
+	 *
+	 * @param fileName Path of the file.
+	 * @return Instances.
+	 * @throws RaceException if the file cannot be read or is empty.
+	 */
+	static std::vector<Instance> loadInstances(const std::string& fileName);
+
+	/**
+	 * @class RaceException
+	 * @brief Exception class for handling tuning errors.
+	 */
+	class RaceException : public ACSException {
+	public:
+		RaceException(ExceptionType type, const std::string& message) : ACSException(type, message, "IteratedRace") {}
+	};
+
+private:
+	std::vector<Param>	  space;	 ///< Tuned parameters
+	std::vector<Instance> instances; ///< Tuning instances
+	size_t				  budget;	 ///< Total number of runs
+	size_t				  numWorkers; ///< Maximum number of concurrent runs
+	Evaluator			  evaluator; ///< Function running a configuration
+	Random				  rnd;		 ///< Random number generator of the sampling
+
+	size_t numIterations; ///< Number of iterations of the budget
+	size_t minSurvivors;  ///< A race stops when this many configurations survive
+	double sdFactor;	  ///< Standard deviation of the numerical parameters (fraction of their range)
+
+	std::vector<Config>				  configs;	   ///< Every configuration sampled
+	std::vector<Block>				  blocks;	   ///< Blocks of the races, in order
+	std::vector<size_t>				  instOrder;   ///< Shuffled instance indices of the current pass
+	std::vector<Run>				  runs;		   ///< Race log
+	std::vector<Test>				  tests;	   ///< Statistical tests
+	std::map<std::pair<size_t, size_t>, size_t> cache; ///< (configuration, block) -> index in runs
+	std::vector<size_t>				  elites;	   ///< Elites of the last race, best first
+
+	/**
+	 * @brief Gets a block of the races, drawing the next ones if needed (instances are
+	 *        visited in a shuffled order, then again with new seeds).
+	 *
+	 * @param index Index of the block.
+	 * @return The block.
+	 */
+	const Block& block(size_t index);
+
+	/**
+	 * @brief Samples a configuration: uniformly at the first iteration, around an elite
+	 *        (drawn with weights decreasing with its rank) afterwards.
+	 *
+	 * @param iteration Index of the iteration.
+	 * @return Index of the new configuration.
+	 */
+	size_t sample(size_t iteration);
+
+	/**
+	 * @brief Runs the configurations without a cached result on a block, in parallel.
+	 *
+	 * @param alive Configurations to run.
+	 * @param blockIdx Index of the block.
+	 * @return Number of runs started.
+	 */
+	size_t evaluate(const std::vector<size_t>& alive, size_t blockIdx);
+
+	/**
+	 * @brief Races a set of configurations.
+	 *
+	 * @param iteration Index of the iteration.
+	 * @param alive Configurations of the race (elites first); the discarded ones are removed.
+	 * @param raceBudget Maximum number of runs of the race.
+	 * @param visited Blocks of the race, in order (output).
+	 * @return Runs used.
+	 */
+	size_t race(size_t iteration, std::vector<size_t>& alive, size_t raceBudget, std::vector<size_t>& visited);
+
+	/**
+	 * @brief Friedman test and Conover post-hoc comparisons on the blocks of a race.
+	 *
+	 * @param iteration Index of the iteration (log only).
+	 * @param alive Configurations compared; the discarded ones are removed.
+	 * @param visited Blocks compared.
+	 */
+	void friedmanTest(size_t iteration, std::vector<size_t>& alive, const std::vector<size_t>& visited);
+
+	/**
+	 * @brief Rank sums of configurations over a set of blocks (average ranks on ties).
+	 *
+	 * @param alive Configurations to rank.
+	 * @param visited Blocks compared.
+	 * @param sumSqRanks Sum of the squared ranks (output).
+	 * @return Rank sum of each configuration.
+	 */
+	std::vector<double> rankSums(const std::vector<size_t>& alive, const std::vector<size_t>& visited, double& sumSqRanks);
+
+	/**
+	 * @brief Survival function of the chi-squared distribution.
+	 *
+	 * @param x Value.
+	 * @param df Degrees of freedom.
+	 * @return P(X > x).
+	 */
+	static double chiSquareSF(double x, double df);
+
+	/**
+	 * @brief Quantile of the Student t distribution.
+	 *
+	 * @param p Probability, within (0.5,1).
+	 * @param df Degrees of freedom.
+	 * @return t such that P(T <= t) = p.
+	 */
+	static double tQuantile(double p, double df);
+};
+
+#endif
@@ -16,6 +16,7 @@
 #define MIP_SOL_H
 
 #include <cplex.h>
+#include <mutex>
 
 #include "Utils.hpp"
 using namespace Utils;
@@ -25,7 +26,6 @@ using namespace Utils;
 #define INST_DIR "../data/"
 
 /** CPELX Execution Constants */
-#define CPLEX_CORE 1
 #define NUM_SOL_STOP 1
 // #define ACS_CB_CONTEXTMASK CPX_CALLBACKCONTEXT_GLOBAL_PROGRESS | CPX_CALLBACKCONTEXT_CANDIDATE
 
@@ -33,6 +33,13 @@ using namespace Utils;
 #define MIP_GAP_TOL 1e-6		   // Default value for CPX_PARAM_EPGAP (see IBM ILOG CPLEX doc)
 #define MIP_INT_TOL 1e-3
 #define MIP_SIMPLEX_FEAS_TOL 1e-3
+/** Solve code of a complete search with cutoff that found no improving solution (not a CPLEX code) */
+#define MIP_NO_IMPROVEMENT -1
+
+/** Slack columns are named only in debug builds (override with -DMIP_COL_NAMES=1) */
+#ifndef MIP_COL_NAMES
+#define MIP_COL_NAMES (ACS_VERBOSE == DEBUG)
+#endif
 
 /**
  * @struct VarBounds
@@ -53,6 +60,25 @@ struct Solution {
 	double				oMIPCost; ///< Objective cost of the MIP solution
 };
 
+/**
+ * @struct InstanceFeatures
+ * @brief Static features of the original MIP, computed once when the first model is read
+ */
+struct InstanceFeatures {
+	size_t rows;	   ///< Number of constraints
+	size_t cols;	   ///< Number of variables
+	size_t nnz;		   ///< Number of non-zero entries of the matrix
+	double density;	   ///< nnz / (rows * cols)
+	double binFrac;	   ///< Fraction of binary variables
+	double intFrac;	   ///< Fraction of general integer variables
+	double contFrac;   ///< Fraction of continuous variables
+	double rowLenMean; ///< Mean number of non-zeros per row
+	double rowLenStd;  ///< Standard deviation of the non-zeros per row
+	size_t rowLenMin;  ///< Minimum number of non-zeros in a row
+	size_t rowLenMax;  ///< Maximum number of non-zeros in a row
+	double eqFrac;	   ///< Fraction of equality rows
+};
+
 /**
  * @class MIPException
  * @brief Custom exception class for MIP-related errors
@@ -95,6 +121,19 @@ public:
 	 */
 	MIP& setNumCores(const int numCores);
 
+	/**
+	 * @brief Binds the CPLEX threads to a set of logical CPUs (CPXPARAM_CPUmask)
+	 * @param cpus IDs of the logical CPUs (empty: let CPLEX decide)
+	 * @return Reference to the current MIP object
+	 */
+	MIP& setCPUMask(const std::vector<int>& cpus);
+
+	/**
+	 * @brief Run CPLEX in deterministic parallel mode (same result for the same number of threads)
+	 * @return Reference to the current MIP object
+	 */
+	MIP& setDeterministic();
+
 	/**
 	 * @brief Sets the number of MIP solutions to be found before stopping
 	 * @param numSols Number of solutions
@@ -102,6 +141,27 @@ public:
 	 */
 	MIP& setNumSols(const int numSols);
 
+	/**
+	 * @brief Sets the objective cutoff: nodes that cannot improve on it are pruned
+	 * @param cutoff Upper cutoff value (minimization problem)
+	 * @return Reference to the current MIP object
+	 */
+	MIP& setCutoff(const double cutoff);
+
+	/**
+	 * @brief Sets the objective value that stops the search as soon as an incumbent reaches it
+	 * @param objStop Lower objective stop value (minimization problem)
+	 * @return Reference to the current MIP object
+	 */
+	MIP& setObjStop(const double objStop);
+
+	/**
+	 * @brief Check wheter an objective cutoff has been set on the model
+	 * @return Bool that is true if MIP::setCutoff has been called
+	 */
+	[[nodiscard]]
+	inline bool hasCutoff() const noexcept { return cutoffSet; }
+
 	/**
 	 * @brief Sets the callback function whenever some CPLEX contexts trigger it
 	 * @param contextMask Context in which the callback is triggered (as CPXLONG)
@@ -125,6 +185,21 @@ public:
 	 */
 	int solve(const double timeLimit = CPX_INFBOUND, const double detTimeLimit = CPX_INFBOUND);
 
+	/**
+	 * @brief Solve the LP relaxation of the problem (the model is turned into an LP for good)
+	 * @param timeLimit Maximum solving time (default: infinite)
+	 * @param detTimeLimit Deterministic time limit (default: infinite)
+	 * @return Solving status code
+	 */
+	int solveLP(const double timeLimit = CPX_INFBOUND, const double detTimeLimit = CPX_INFBOUND);
+
+	/**
+	 * @brief Get the deterministic time (ticks) spent by the last MIP::solve call
+	 * @return Deterministic ticks used
+	 */
+	[[nodiscard]]
+	inline double getLastDetTime() const noexcept { return lastDetTime; }
+
 	/**
 	 * @brief Add a MIP start solution
 	 * @param MIPStart Vector of initial solution values
@@ -133,6 +208,20 @@ public:
 	 */
 	MIP& addMIPStart(const std::vector<double>& MIPStart, bool CPLEXCheck = false);
 
+	/**
+	 * @brief Add a MIP start on the original MIP variables only: CPLEX fixes their integer values
+	 *        and solves for the remaining columns (e.g. the slack columns)
+	 * @param MIPVarsStart Vector of initial values (at least getMIPNumVars() entries)
+	 * @return Reference to the current MIP object
+	 */
+	MIP& addMIPVarsStart(const std::vector<double>& MIPVarsStart);
+
+	/**
+	 * @brief Delete all the MIP starts of the model
+	 * @return Reference to the current MIP object
+	 */
+	MIP& deleteMIPStarts();
+
 	/**
 	 * @brief Get the objective value of the solution
 	 * @return Objective value
@@ -161,6 +250,13 @@ public:
 	[[nodiscard]]
 	std::vector<double> getSol();
 
+	/**
+	 * @brief Get the reduced costs of the last LP solved (see MIP::solveLP)
+	 * @return Vector of reduced costs
+	 */
+	[[nodiscard]]
+	std::vector<double> getReducedCosts();
+
 	/// FIXED: Bug #68f1c9b8703f4f30f98c6bf5b01fb3253799a9c6 — UNBOUNDED case was not handled in the infeasibility check.
 	/**
 	 * @brief Check wheter a solve code from CPLEXgetstat says that the problem is INFeasible or UNBounDed
@@ -175,6 +271,43 @@ public:
 				solveCode == CPXMIP_UNBOUNDED);
 	}
 
+	/**
+	 * @brief Check if the solve was stopped by a (deterministic) time limit
+	 * @param solveCode Code returned by CPXgetstat
+	 * @return True if a time limit was hit, with or without a solution
+	 */
+	[[nodiscard]]
+	static bool isTimeLimit(const int solveCode) {
+		return (solveCode == CPXMIP_TIME_LIM_FEAS ||
+				solveCode == CPXMIP_TIME_LIM_INFEAS ||
+				solveCode == CPXMIP_DETTIME_LIM_FEAS ||
+				solveCode == CPXMIP_DETTIME_LIM_INFEAS);
+	}
+
+	/**
+	 * @brief Map the INF solve code of a model with cutoff to the code of the same search without cutoff
+	 *
+	 * With an objective cutoff, CPLEX reports a neighborhood without improving solutions as infeasible:
+	 * a complete search becomes MIP_NO_IMPROVEMENT (callers decide how to count it), a search stopped
+	 * by a limit becomes *_LIM_FEAS.
+	 *
+	 * @param solveCode Code returned by CPXgetstat
+	 * @return Equivalent solve code without cutoff
+	 */
+	[[nodiscard]]
+	static int cutoffSolveCode(const int solveCode) {
+		switch (solveCode) {
+			case CPXMIP_INFEASIBLE:
+				return MIP_NO_IMPROVEMENT;
+			case CPXMIP_DETTIME_LIM_INFEAS:
+				return CPXMIP_DETTIME_LIM_FEAS;
+			case CPXMIP_TIME_LIM_INFEAS:
+				return CPXMIP_TIME_LIM_FEAS;
+			default:
+				return solveCode;
+		}
+	}
+
 	/**
 	 * @brief Get the number of MIP variables
 	 * @return Number of variables
@@ -219,6 +352,20 @@ public:
 	 */
 	MIP& addCol(const size_t index, const double value, const double objCoef, const double lb, const double ub, const std::string name);
 
+	/**
+	 * @brief Append a block of columns with a single CPXaddcols call
+	 * @param objCoefs Objective function coefficients (one per new column)
+	 * @param cmatbeg Start of each column inside cmatind/cmatval
+	 * @param cmatind Row indices of the non-zero entries
+	 * @param cmatval Values of the non-zero entries
+	 * @param lbs Lower bounds (one per new column)
+	 * @param ubs Upper bounds (one per new column)
+	 * @param names Column names (empty: columns are left unnamed)
+	 * @return Reference to the current MIP object
+	 */
+	MIP& addCols(const std::vector<double>& objCoefs, const std::vector<int>& cmatbeg, const std::vector<int>& cmatind, const std::vector<double>& cmatval,
+				 const std::vector<double>& lbs, const std::vector<double>& ubs, const std::vector<std::string>& names = {});
+
 	/**
 	 * @brief Add a new row (constraint) to the problem
 	 * @param newRow Vector representing the row
@@ -228,6 +375,24 @@ public:
 	 */
 	MIP& addRow(const std::vector<double>& newRow, const char sense, const double rhs);
 
+	/**
+	 * @brief Add a new sparse row (constraint) to the problem; with the bound journal on, the row is
+	 *        recorded and restoreBounds removes it
+	 * @param indices Column indices of the non-zeros
+	 * @param values Coefficients of the non-zeros
+	 * @param sense Constraint sense (<=, =, >=)
+	 * @param rhs Right-hand side of the constraint
+	 * @return Reference to the current MIP object
+	 */
+	MIP& addRow(const std::vector<int>& indices, const std::vector<double>& values, const char sense, const double rhs);
+
+	/**
+	 * @brief Get a key of the rows recorded by the bound journal (see addRow)
+	 * @return Hash of the recorded rows (Hash::OFFSET if none)
+	 */
+	[[nodiscard]]
+	inline uint64_t getJournalRowsKey() const noexcept { return journalRowsKey; }
+
 	/**
 	 * @brief Remove a row at a specific index
 	 * @param index Row index to remove
@@ -249,6 +414,14 @@ public:
 	 */
 	VarBounds getVarBounds(const int index);
 
+	/**
+	 * @brief Get the bounds of all the variables (two CPLEX calls)
+	 * @param lb Lower bounds (output)
+	 * @param ub Upper bounds (output)
+	 * @return Reference to the current MIP object
+	 */
+	MIP& getBounds(std::vector<double>& lb, std::vector<double>& ub);
+
 	/**
 	 * @brief Get the type of a variable
 	 *
@@ -292,6 +465,37 @@ public:
 	 */
 	MIP& setVarsValues(const std::vector<double>& values);
 
+	/**
+	 * @brief Set the values of a subset of variables with a single CPXchgbds call
+	 * @param indices Variable indices
+	 * @param values Variable values (one per index)
+	 * @return Reference to the current MIP object
+	 */
+	MIP& setVarsValues(const std::vector<int>& indices, const std::vector<double>& values);
+
+	/**
+	 * @brief Set the lower and upper bounds of a set of variables with a single CPXchgbds call
+	 * @param indices Variable indices
+	 * @param lbs New lower bounds (one per index)
+	 * @param ubs New upper bounds (one per index)
+	 * @return Reference to the current MIP object
+	 */
+	MIP& setVarsBounds(const std::vector<int>& indices, const std::vector<double>& lbs, const std::vector<double>& ubs);
+
+	/**
+	 * @brief Start recording the variables whose bounds are changed (setVarValue, setVarLowerBound,
+	 *        setVarUpperBound), saving the current bounds to restore them later
+	 * @return Reference to the current MIP object
+	 */
+	MIP& startBoundJournal();
+
+	/**
+	 * @brief Restore the bounds saved by startBoundJournal on all the recorded variables (one CPXchgbds call),
+	 *        remove the recorded rows and clear the journal, which keeps recording
+	 * @return Reference to the current MIP object
+	 */
+	MIP& restoreBounds();
+
 	/**
 	 * @brief Check the feasibility of a solution
 	 * @param sol Solution vector to check
@@ -318,6 +522,53 @@ public:
 	[[nodiscard]]
 	inline const std::vector<std::vector<int>>& getMIPConstrToVar() { return MIPConstrToVar; }
 
+	/**
+	 * @brief Get the constraint matrix of the original MIP in CSR format (shared by all the MIP objects)
+	 * @return Start of each row inside MIP::getMIPRowInd and MIP::getMIPRowVal
+	 */
+	[[nodiscard]]
+	inline const std::vector<int>& getMIPRowBeg() { return MIPrmatbeg; }
+
+	[[nodiscard]]
+	inline const std::vector<int>& getMIPRowInd() { return MIPrmatind; }
+
+	[[nodiscard]]
+	inline const std::vector<double>& getMIPRowVal() { return MIPrmatval; }
+
+	[[nodiscard]]
+	inline const std::vector<char>& getMIPSense() { return MIPsense; }
+
+	[[nodiscard]]
+	inline const std::vector<double>& getMIPRhs() { return MIPrhs; }
+
+	/**
+	 * @brief Get the variable types of the original MIP (shared by all the MIP objects, read once)
+	 * @return CPLEX ctype of each MIP variable
+	 */
+	[[nodiscard]]
+	inline const std::vector<char>& getMIPVarTypes() { return MIPctype; }
+
+	/**
+	 * @brief Get the binary and integer variables of the original MIP (shared by all the MIP objects)
+	 * @return Indices of the integer variables, in increasing order
+	 */
+	[[nodiscard]]
+	inline const std::vector<int>& getMIPIntVars() { return MIPIntVars; }
+
+	/**
+	 * @brief Get the continuous variables of the original MIP (shared by all the MIP objects)
+	 * @return Indices of the continuous variables, in increasing order
+	 */
+	[[nodiscard]]
+	inline const std::vector<int>& getMIPContVars() { return MIPContVars; }
+
+	/**
+	 * @brief Get the features of the original MIP (shared by all the MIP objects, computed once)
+	 * @return Instance features
+	 */
+	[[nodiscard]]
+	inline const InstanceFeatures& getMIPFeatures() { return MIPFeatures; }
+
 	[[nodiscard]]
 	double violation(const std::vector<double>& sol);
 
@@ -359,8 +610,23 @@ public:
 	~MIP() noexcept;
 
 protected:
-	CPXLPptr  model; ///< CPLEX LP problem pointer
-	CPXENVptr env;	 ///< CPLEX environment pointer
+	CPXLPptr  model;			   ///< CPLEX LP problem pointer
+	CPXENVptr env;				   ///< CPLEX environment pointer
+	bool	  cutoffSet{ false }; ///< True if an objective cutoff is active
+	double	  lastDetTime{ 0.0 }; ///< Deterministic ticks spent by the last solve
+
+	bool				journalOn{ false }; ///< True if bound changes are recorded
+	std::vector<int>	journalIdx;			///< Variables whose bounds changed since the last restore
+	std::vector<double> journalLB;			///< Lower bounds saved by startBoundJournal
+	std::vector<double> journalUB;			///< Upper bounds saved by startBoundJournal
+	size_t				journalRows{ 0 };	///< Rows added since the last restore (the last ones of the model)
+	uint64_t			journalRowsKey{ Hash::OFFSET }; ///< Hash of the rows added since the last restore
+
+	/**
+	 * @brief Append the positive (SP_i) and negative (SN_i) slack column of every row in one call
+	 * @param objCoef Objective function coefficient shared by all the slack columns
+	 */
+	void addSlackCols(const double objCoef);
 
 // Debug-specific methods
 #if ACS_VERBOSE == DEBUG
@@ -377,6 +643,12 @@ protected:
 
 	static std::vector<std::vector<int>> MIPVarToConstr;
 	static std::vector<std::vector<int>> MIPConstrToVar;
+
+	static std::vector<char> MIPctype;
+	static std::vector<int>	 MIPIntVars;
+	static std::vector<int>	 MIPContVars;
+
+	static InstanceFeatures MIPFeatures;
 };
 
 #endif
\ No newline at end of file
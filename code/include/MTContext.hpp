@@ -20,7 +20,9 @@
 #define MT_CTX_H
 
 #include <atomic>
+#include <memory>
 #include <mutex>
+#include <span>
 #include <thread>
 
 #include "Utils.hpp"
@@ -29,8 +31,16 @@ using namespace Utils;
 #include "FixPolicy.hpp"
 using namespace FixPolicy;
 
+#include "CoreScheduler.hpp"
+#include "DetBudget.hpp"
+#include "ElasticWorkers.hpp"
+#include "ElitePool.hpp"
+#include "NeighborhoodCache.hpp"
 #include "FMIP.hpp"
 #include "OMIP.hpp"
+#include "PolicyPortfolio.hpp"
+#include "Propagator.hpp"
+#include "RhoController.hpp"
 
 /**
  * @class MTContext
@@ -44,6 +54,29 @@ using namespace FixPolicy;
 class MTContext {
 
 public:
+	/**
+	 * @struct PhaseTimes
+	 * @brief Wall times (summed over the workers) of the work done for a kind of solve.
+	 */
+	struct PhaseTimes {
+		double setup;	  ///< Model building and fixing on the critical path
+		double hidden;	  ///< Model building and fixing overlapped with a merge MIP solve
+		double refresh;	  ///< Refresh of the fixings of prepared subMIPs
+		double solve;	  ///< Solve time
+		size_t prepared;  ///< SubMIPs prepared during a merge MIP solve
+		size_t refreshed; ///< Prepared subMIPs whose fixings had to be refreshed
+		size_t discarded; ///< Prepared subMIPs thrown away (a different phase followed)
+	};
+
+	/**
+	 * @struct IncumbentSample
+	 * @brief Feasible incumbent found during the run (primal trajectory).
+	 */
+	struct IncumbentSample {
+		double time; ///< Seconds since the start of the run
+		double cost; ///< Objective cost of the incumbent
+	};
+
 	/**
 	 * @brief Constructs an MTContext object with a specified number of threads
 	 *        and an initial random seed.
@@ -52,8 +85,24 @@ public:
 	 *                  the number of hardware threads available).
 	 * @param initialSeed The initial seed for random number generation (default is
 	 *                    a random device seed).
+	 * @param numCores The core budget split among the CPLEX threads of the subMIPs (default is
+	 *                 the number of hardware threads available).
+	 * @param pin Whether workers are pinned to NUMA-local core sets (default is false).
+	 * @param elastic Whether the number of concurrent subMIPs changes between rounds, within
+	 *                max(subMIPNum, numCores) worker slots (default is false).
+	 * @param deterministic Whether worker outcomes are committed in worker order at the end of
+	 *                      each phase and CPLEX runs in deterministic parallel mode (default is false).
+	 * @param portfolio Whether each worker draws its fixing policy from a bandit over the
+	 *                  PolicyPortfolio policies (default is false: a single policy).
+	 * @param fixPolicy Index of the PolicyPortfolio::Policy used when the portfolio is off
+	 *                  (default is 0: random rho-fixing).
+	 * @param eliteSize Capacity of the elite solution pool (default is 0: no pool).
+	 * @param nbhCache Whether workers skip the neighborhoods whose outcome is already known
+	 *                 (default is false).
+	 * @param rho Initial rho of every worker, then adapted by each worker on its own subMIPs
+	 *            (default is DEF_RHO).
 	 */
-	MTContext(size_t subMIPNum = std::thread::hardware_concurrency(), unsigned long long intialSeed = std::random_device{}());
+	MTContext(size_t subMIPNum = std::thread::hardware_concurrency(), unsigned long long intialSeed = std::random_device{}(), size_t numCores = std::thread::hardware_concurrency(), bool pin = false, bool elastic = false, bool deterministic = false, bool portfolio = false, size_t fixPolicy = 0, size_t eliteSize = 0, bool nbhCache = false, double rho = DEF_RHO);
 
 	/**
 	 * @brief Deleted copy constructor to prevent copying of MTContext objects.
@@ -84,28 +133,119 @@ public:
 	inline const Solution& getBestACSIncumbent() { return bestACSIncumbent; }
 
 	/**
-	 * @brief Gets the number of times Rho has been changed.
+	 * @brief Check if bestACSIncumbent is a feasible solution for the MIP problem
+	 *
+	 * @return Boolean statign wheter bestACSIncumbent is a feasible solution or not
+	 */
+	[[nodiscard]]
+	inline bool isFeasibleSolFound() { return (bestACSIncumbent.slackSum <= EPSILON && bestACSIncumbent.oMIPCost < CPX_INFBOUND); }
+
+	/**
+	 * @brief Gets the feasible incumbents found so far, in order of time.
 	 * BE CAREFULL:: use only in a single-thread scenario!
 	 *
-	 * @return Number of times Rho has been changed.
+	 * @return The primal trajectory.
 	 */
 	[[nodiscard]]
-	inline size_t getRhoChanges() { return A_RhoChanges; }
+	inline const std::vector<IncumbentSample>& getPrimalTrajectory() { return primalTrajectory; }
 
 	/**
-	 * @brief Check if bestACSIncumbent is a feasible solution for the MIP problem
+	 * @brief Computes the primal integral of the run: the integral over [0, endTime] of the primal gap
+	 *        of the incumbent with respect to the best incumbent found (gap 1 before the first feasible one).
+	 * BE CAREFULL:: use only in a single-thread scenario!
 	 *
-	 * @return Boolean statign wheter bestACSIncumbent is a feasible solution or not
+	 * @param endTime End of the integration (seconds since the start of the run).
+	 * @param numSamples Number of samples of the trajectory used (e.g. 1: the run stopped at the
+	 *                   first feasible solution, which is kept until endTime).
+	 * @return The primal integral (in seconds).
 	 */
 	[[nodiscard]]
-	inline bool isFeasibleSolFound() { return (bestACSIncumbent.slackSum <= EPSILON && bestACSIncumbent.oMIPCost < CPX_INFBOUND); }
+	double getPrimalIntegral(double endTime, size_t numSamples = SIZE_MAX);
+
+	/**
+	 * @brief Gets the number of subMIPs solved by the workers so far.
+	 *
+	 * @return Number of subMIPs solved.
+	 */
+	[[nodiscard]]
+	inline size_t getNumSubMIPs() { return A_NumSubMIPs; }
+
+	/**
+	 * @brief Gets the number of subMIPs proven without improving solutions by the objective cutoff.
+	 *
+	 * @return Number of subMIPs pruned by the objective cutoff.
+	 */
+	[[nodiscard]]
+	inline size_t getNumCutoffSubMIPs() { return A_NumCutoffSubMIPs; }
+
+	/**
+	 * @brief Gets the core budget (the number of CPLEX threads of the merge MIPs).
+	 *
+	 * @return The number of cores.
+	 */
+	[[nodiscard]]
+	inline size_t getNumCores() { return coreSched.getNumCores(); }
+
+	/**
+	 * @brief Checks whether the context runs in deterministic mode.
+	 *
+	 * @return True if the same seed and core count give the same trajectory.
+	 */
+	[[nodiscard]]
+	inline bool isDeterministic() const noexcept { return deterministic; }
+
+	/**
+	 * @brief Gets the controller of the deterministic time limits.
+	 *
+	 * @return Reference to the DetBudget controller shared by workers and merge MIPs.
+	 */
+	[[nodiscard]]
+	inline DetBudget& getDetBudget() { return detBudget; }
+
+	/**
+	 * @brief Gets the timings of a kind of solve.
+	 * BE CAREFULL:: use only in a single-thread scenario!
+	 *
+	 * @param phase Kind of solve.
+	 * @return Timings of the phase.
+	 */
+	[[nodiscard]]
+	inline const PhaseTimes& getPhaseTimes(DetBudget::Phase phase) { return phaseTimes[static_cast<size_t>(phase)]; }
+
+	/**
+	 * @brief Adds setup and solve time to the timings of a kind of solve (used by the merge MIPs).
+	 *
+	 * @param phase Kind of solve.
+	 * @param setup Model building and fixing time.
+	 * @param solve Solve time.
+	 */
+	void addPhaseTimes(DetBudget::Phase phase, double setup, double solve);
+
+	/**
+	 * @brief Sets cutoff and objective-stop of an FMIP from the current incumbent.
+	 *
+	 * The cutoff is the incumbent slack sum, the search stops as soon as the slack sum is zero.
+	 *
+	 * @param fMIP The FMIP model (subMIP or merge MIP) to limit.
+	 */
+	void setFMIPObjLimits(MIP& fMIP);
+
+	/**
+	 * @brief Sets the cutoff of an OMIP from the current incumbent.
+	 *
+	 * The cutoff is set only once the incumbent is feasible: before that, OMIP solutions
+	 * can be accepted for their lower slack sum even if their cost is worse.
+	 *
+	 * @param oMIP The OMIP model (subMIP or merge MIP) to limit.
+	 */
+	void setOMIPObjLimits(MIP& oMIP);
 
 	/**
 	 * @brief Sets the best ACS incumbent solution.
 	 *
 	 * @param sol The solution to set as the best ACS incumbent.
 	 */
-	void setBestACSIncumbent(Solution& sol);
+	void setBestACSIncumbent(const Solution& sol);
 
 	// inline void setIncumbentAmongMIPsSize(size_t newSize) { incumbentAmongMIPs.sol.resize(newSize, 0.0); } FIXME: v0.0.11 - remove it
 
@@ -117,28 +257,126 @@ public:
 	inline void setBestACSIncumbentSize(size_t newSize) { bestACSIncumbent.sol.resize(newSize, 0.0); }
 
 	/**
-	 * @brief Gets the temporary solutions stored for optimization.
+	 * @brief Gets the temporary solutions of the workers of the last parallel phase.
+	 *
+	 * @return A view of the temporary solutions of the active worker slots.
+	 */
+	[[nodiscard]]
+	inline std::span<const Solution> getTmpSolutions() { return { tmpSolutions.data(), numActive }; }
+
+	/**
+	 * @brief Gets the blocks freed by the workers of the last parallel phase (block policy).
+	 * BE CAREFULL:: valid until the policies of the next phase are drawn (MTContext::prepareNextPhase)!
+	 *
+	 * @return A view of the block of each active worker slot (-1 if not fixed by blocks).
+	 */
+	[[nodiscard]]
+	inline std::span<const int> getWorkerBlocks() { return { workerBlocks.data(), numActive }; }
+
+	/**
+	 * @brief Gets the solutions of the next recombination.
 	 *
-	 * @return A reference to the vector of temporary solutions.
+	 * Without elite pool these are the temporary solutions of the workers. With it, duplicate
+	 * worker solutions are dropped and the ELITE_MERGE_SOLS best elite members are added.
+	 * BE CAREFULL:: use only in a single-thread scenario!
+	 *
+	 * @return A view of the solutions to recombine (valid until the next call).
 	 */
 	[[nodiscard]]
-	inline const std::vector<Solution>& getTmpSolutions() { return tmpSolutions; }
+	std::span<const Solution> getMergeSolutions();
 
 	/**
 	 * @brief Broadcasts a temporary solution to all threads.
 	 *
+	 * With the elite pool, one slot every ELITE_START_STRIDE gets instead an elite member,
+	 * the farthest ones from tmpSol first.
+	 *
 	 * @param tmpSol The temporary solution to broadcast.
 	 * @return Reference to the current MTContext object.
 	 */
 	MTContext& broadcastSol(Solution& tmpSol);
 
 	/**
-	 * @brief Gets the number of threads used for optimization.
+	 * @brief Gives each worker slot its own starting solution (e.g. the assignments of FeasJump).
+	 *
+	 * Slot i gets sols[i % sols.size()]: pass the best solutions first.
+	 *
+	 * @param sols The solutions to spread over the worker slots.
+	 * @return Reference to the current MTContext object.
+	 */
+	MTContext& seedSolutions(std::span<const Solution> sols);
+
+	/**
+	 * @brief Gets the number of worker slots.
+	 *
+	 * @return Maximum number of concurrent subMIPs.
+	 */
+	[[nodiscard]]
+	inline size_t getNumMIPs() const noexcept { return numMIPs; }
+
+	/**
+	 * @brief Gets the number of subMIPs solved concurrently in the last parallel phase.
+	 *
+	 * @return The number of active workers.
+	 */
+	[[nodiscard]]
+	inline size_t getNumThreads() { return numActive; }
+
+	/**
+	 * @brief Gets the controller of the number of concurrent subMIPs.
+	 *
+	 * @return Reference to the ElasticWorkers controller.
+	 */
+	[[nodiscard]]
+	inline ElasticWorkers& getElasticWorkers() { return elasticWorkers; }
+
+	/**
+	 * @brief Gets the portfolio of fixing policies.
+	 *
+	 * @return Reference to the PolicyPortfolio bandit.
+	 */
+	[[nodiscard]]
+	inline PolicyPortfolio& getPolicyPortfolio() { return policyPortfolio; }
+
+	/**
+	 * @brief Gets the elite solution pool.
+	 *
+	 * @return Reference to the ElitePool fed by the workers.
+	 */
+	[[nodiscard]]
+	inline ElitePool& getElitePool() { return elitePool; }
+
+	/**
+	 * @brief Gets the cache of the subMIP outcomes.
+	 *
+	 * @return Reference to the NeighborhoodCache of the workers.
+	 */
+	[[nodiscard]]
+	inline NeighborhoodCache& getNeighborhoodCache() { return nbhCache; }
+
+	/**
+	 * @brief Gets the rho controller of the workers.
 	 *
-	 * @return The number of threads.
+	 * @return Reference to the RhoController of the workers.
 	 */
 	[[nodiscard]]
-	inline size_t getNumThreads() { return numMIPs; }
+	inline const RhoController& getRhoController() const { return rhoCtl; }
+
+	/**
+	 * @brief Turns on the bound propagation of the fixed subMIPs.
+	 *
+	 * @param fileName Name of the instance.
+	 * @return Reference to the current MTContext object.
+	 */
+	MTContext& enablePropagation(const std::string& fileName);
+
+	/**
+	 * @brief Gets the bound propagation of the fixed subMIPs.
+	 *
+	 * @return Pointer to the Propagator (nullptr if the propagation is off).
+	 */
+	[[nodiscard]]
+	inline const Propagator* getPropagator() const noexcept { return propagator.get(); }
 
 	/**
 	 * @brief Starts parallel optimization using the FMIP method.
@@ -155,32 +393,220 @@ public:
 	 */
 	MTContext& parallelOMIPOptimization(Args& CLIArgs, double rhs);
 
+	/**
+	 * @brief Starts building the subMIPs of the next parallel phase while the caller solves a merge MIP.
+	 *
+	 * Every worker loads its model and fixes it against the current incumbent (which is what gets
+	 * broadcast when the merge does not improve it). The next parallel phase of the same kind
+	 * takes the prepared models, refreshing their fixings only if incumbent, broadcast solution
+	 * or rho changed in the meantime. Does nothing if the pipeline is off or there is no incumbent.
+	 *
+	 * @param CLIArgs The command-line arguments for optimization.
+	 * @param phase Kind of the next parallel phase (DetBudget::Phase::FMIP or DetBudget::Phase::OMIP).
+	 * @return Reference to the current MTContext object.
+	 */
+	MTContext& prepareNextPhase(Args& CLIArgs, DetBudget::Phase phase);
+
 	/**
 	 * @brief Destructor for MTContext. Cleans up resources used by the context.
 	 */
 	~MTContext();
 
 private:
-	size_t					 numMIPs;		   ///< Number of threads used for optimization.
+	/**
+	 * @struct PreparedSubMIP
+	 * @brief SubMIP built ahead by a worker (see MTContext::prepareNextPhase).
+	 */
+	struct PreparedSubMIP {
+		std::unique_ptr<MIP>	model;	///< Model with speculative fixings (nullptr if none)
+		Random					rnd;	///< Random generator of the worker before the fixing
+		double					rho;	///< Rho used for the fixing
+		PolicyPortfolio::Policy policy; ///< Fixing policy applied
+		int						block;	///< Block left free (-1 if not fixed by blocks)
+	};
+
+	/**
+	 * @struct WorkerResult
+	 * @brief Outcome of a subMIP, applied to the shared state by MTContext::commitWorkerResult.
+	 */
+	struct WorkerResult {
+		bool					pending;		///< True if not committed yet
+		DetBudget::Phase		phase;			///< Kind of subMIP
+		DetBudget::Budget		budget;			///< Budget of the solve
+		int						solveCode;		///< Code returned by the solve
+		double					ticks;			///< Deterministic ticks used
+		double					solveTime;		///< Wall time of the solve
+		double					improvement;	///< Relative improvement over the incumbent at the start of the job
+		size_t					nnz;			///< Non-zeros of the subMIP
+		bool					cutoff;			///< True if the subMIP had an objective cutoff
+		PolicyPortfolio::Policy	policy;			///< Fixing policy of the subMIP
+		double					fixTime;		///< Wall time of the last fixing of the subMIP
+		uint64_t				signature;		///< Signature of the neighborhood (NeighborhoodCache)
+		size_t					version;		///< Incumbent version the subMIP was fixed against
+	};
+
+	static constexpr size_t NUM_PHASES{ static_cast<size_t>(DetBudget::Phase::_count) };
+
+	size_t					 numMIPs;		   ///< Number of worker slots (maximum number of concurrent subMIPs).
+	size_t					 numActive;		   ///< Number of workers of the last parallel phase.
+	bool					 deterministic;	   ///< Deterministic mode flag.
+	ElasticWorkers			 elasticWorkers;   ///< Controller of the number of active workers.
+	DetBudget				 detBudget;		   ///< Controller of the deterministic time limits.
+	CoreScheduler			 coreSched;		   ///< Scheduler of the CPLEX threads of each subMIP.
+	PolicyPortfolio			 policyPortfolio;  ///< Bandit over the fixing policies.
+	ElitePool				 elitePool;		   ///< Distinct good solutions found so far.
+	NeighborhoodCache		 nbhCache;		   ///< Outcomes of the neighborhoods already solved.
+	RhoController			 rhoCtl;		   ///< Rho of each worker.
+	std::unique_ptr<Propagator> propagator;	   ///< Bound propagation of the fixed subMIPs (nullptr: off).
 	std::vector<Solution>	 tmpSolutions;	   ///< Temporary solutions for optimization.
 	std::vector<std::thread> threads;		   ///< Threads used for parallel optimization.
 	std::vector<Random>		 rndGens;		   ///< Random number generators for each thread.
 	Solution				 bestACSIncumbent; ///< Best ACS incumbent solution found.
 	std::mutex				 MTContextMTX;	   ///< Mutex for synchronizing solution updates.
-	std::atomic_size_t		 A_RhoChanges;	   ///< Size_t value used to manage the DynamicFixPolicy
+	std::atomic_size_t		 A_NumSubMIPs;	   ///< Number of subMIPs solved by the workers
+	std::atomic_size_t		 A_NumCutoffSubMIPs; ///< Number of subMIPs without improving solutions (cutoff)
+	std::atomic_size_t		 A_IncumbentVersion; ///< Number of updates of bestACSIncumbent
+	std::vector<IncumbentSample> primalTrajectory; ///< Feasible incumbents over time
+
+	std::vector<PreparedSubMIP>		   prepared;		   ///< SubMIPs prepared by each worker.
+	DetBudget::Phase				   preparedPhase;	   ///< Kind of the prepared subMIPs.
+	Solution						   specIncumbent;	   ///< Incumbent the prepared subMIPs are fixed against.
+	size_t							   specVersion;		   ///< Version of specIncumbent.
+	std::array<PhaseTimes, NUM_PHASES> phaseTimes;		   ///< Timings per kind of solve.
+	std::mutex						   timesMTX;		   ///< Mutex for synchronizing the timings.
+	std::vector<WorkerResult>		   results;			   ///< Outcomes waiting for the end of the phase (deterministic mode).
+	std::vector<size_t>				   reservedArms;	   ///< DetBudget arms reserved for each worker (deterministic mode).
+	std::vector<PolicyPortfolio::Policy> workerPolicies; ///< Fixing policy of the next subMIP of each worker.
+	std::vector<int>				   workerBlocks;	 ///< Block freed by the next subMIP of each worker (-1: none).
+	size_t							   blockCursor;		 ///< Next block handed out by drawPolicies.
+	std::vector<double>				   fixTimes;		 ///< Wall time of the last fixing of each worker.
+	std::vector<std::vector<double>>   prevRefs;		 ///< Reference solution of the previous subMIP of each worker.
+	std::vector<Solution>			   mergeSols;		 ///< Solutions of the next recombination (elite pool on).
 
 	/**
 	 * @brief Waits for all threads to complete their optimization jobs.
 	 */
 	void waitAllJobs();
 
+	/**
+	 * @brief Gets the number of active workers of a phase, checked against the worker slots.
+	 *
+	 * @param phase Kind of subMIP (DetBudget::Phase::FMIP or DetBudget::Phase::OMIP).
+	 * @return Number of active workers.
+	 * @throws ACSException if it exceeds the worker slots (tmpSolutions, rndGens and results are per slot).
+	 */
+	size_t activeWorkers(DetBudget::Phase phase);
+
 	/**
 	 * @brief Sets a temporary solution at the specified index.
 	 *
+	 * Run by the worker thread of the slot, so that the buffer is first-touched on its node.
+	 *
 	 * @param index The index of the solution to set.
 	 * @param tmpSol The temporary solution to set.
 	 */
-	inline void setTmpSolution(int index, Solution& tmpSol) { tmpSolutions[index] = tmpSol; }
+	inline void setTmpSolution(int index, Solution& tmpSol) {
+		coreSched.pinWorker(index);
+		tmpSolutions[index] = tmpSol;
+	}
+
+	/**
+	 * @brief Solves a subMIP, rebalancing its CPLEX threads while it runs.
+	 *
+	 * The deterministic budget is split in CORE_SCHED_SLICES slices: between two slices the
+	 * search is resumed with the core share freed by the workers that already finished.
+	 *
+	 * @param thID The ID of the thread running the job.
+	 * @param model The subMIP to solve.
+	 * @param detTimeLimit The deterministic time limit of the whole solve.
+	 * @param CLIArgs The command-line arguments for the optimization process.
+	 * @param usedTicks Deterministic ticks used by the solve (output).
+	 * @return Solve code of the last slice.
+	 */
+	int solveSubMIP(const size_t thID, MIP& model, const double detTimeLimit, Args& CLIArgs, double& usedTicks);
+
+	/**
+	 * @brief Applies the outcome of a subMIP: budget and elastic statistics, incumbent update
+	 *        and adaptation of the rho of the worker.
+	 *
+	 * @param thID The ID of the worker that solved the subMIP.
+	 * @param result The outcome of the subMIP.
+	 */
+	void commitWorkerResult(const size_t thID, const WorkerResult& result);
+
+	/**
+	 * @brief Commits the outcomes of the phase just ended in worker order (deterministic mode).
+	 *
+	 * The adaptations of the rho of the workers then do not depend on thread timing.
+	 *
+	 * @return Deterministic length of the round (largest number of ticks used by a worker).
+	 */
+	double commitPhaseResults();
+
+	/**
+	 * @brief Draws the fixing policies of the workers of a phase, in worker order.
+	 *
+	 * Workers holding a prepared subMIP of the same kind keep the policy it was fixed with.
+	 * Workers of the block policy get the blocks in turn, so that concurrent subMIPs free
+	 * different blocks.
+	 *
+	 * @param phase Kind of subMIP (DetBudget::Phase::FMIP or DetBudget::Phase::OMIP).
+	 * @param numWorkers Number of workers of the phase.
+	 * @param keepPrepared Whether prepared subMIPs of the same kind keep their policy.
+	 */
+	void drawPolicies(DetBudget::Phase phase, size_t numWorkers, bool keepPrepared);
+
+	/**
+	 * @brief Applies the fixings of a subMIP: MIP start and slack upper bounds from the incumbent,
+	 *        then the fixing policy of the worker around a reference solution.
+	 *
+	 * @param thID The ID of the thread running the job.
+	 * @param type Type of subMIP ("FMIP" or "OMIP").
+	 * @param model The subMIP to fix.
+	 * @param incumbent The incumbent solution.
+	 * @param refSol The solution the variables are fixed to.
+	 * @param rho Fraction of the variables to fix.
+	 * @param policy Fixing policy.
+	 * @param rnd Random number generator of the worker.
+	 */
+	void fixSubMIP(const size_t thID, const char* type, MIP& model, const Solution& incumbent, const std::vector<double>& refSol, double rho, PolicyPortfolio::Policy policy, Random& rnd);
+
+	/**
+	 * @brief Builds and fixes the subMIP of a worker ahead of the next phase (see MTContext::prepareNextPhase).
+	 *
+	 * @param thID The ID of the thread running the job.
+	 * @param CLIArgs The command-line arguments for the optimization process.
+	 * @param rho Rho value at the time of the preparation.
+	 */
+	void prepareSubMIP(const size_t thID, Args& CLIArgs, double rho);
+
+	/**
+	 * @brief Gets the subMIP a worker has to solve: the prepared one (refreshed if needed) or a new one.
+	 *
+	 * @param thID The ID of the thread running the job.
+	 * @param phase Kind of subMIP (DetBudget::Phase::FMIP or DetBudget::Phase::OMIP).
+	 * @param CLIArgs The command-line arguments for the optimization process.
+	 * @return The subMIP, ready to be solved.
+	 */
+	std::unique_ptr<MIP> takeSubMIP(const size_t thID, DetBudget::Phase phase, Args& CLIArgs);
+
+	/**
+	 * @brief Screens the fixed subMIP of a worker before the solve: bound propagation (if on), then
+	 *        the NeighborhoodCache lookup.
+	 *
+	 * Fixings proven infeasible by the propagation, or giving a neighborhood known to be unproductive,
+	 * are redrawn (same policy and rho, new random draws) up to PROP_RETRIES or NBH_CACHE_RETRIES times.
+	 * The bounds tightened by the propagation are set on the subMIP.
+	 *
+	 * @param thID The ID of the thread running the job.
+	 * @param phase Kind of subMIP (DetBudget::Phase::FMIP or DetBudget::Phase::OMIP).
+	 * @param model The fixed subMIP (bound journal on).
+	 * @param detTimeLimit The deterministic time limit of the solve.
+	 * @param signature Signature of the neighborhood to solve (output).
+	 * @param version Incumbent version of the signature (output).
+	 * @return False if every redraw failed the screening and the solve has to be skipped.
+	 */
+	bool screenSubMIP(const size_t thID, DetBudget::Phase phase, MIP& model, const double detTimeLimit, uint64_t& signature, size_t& version);
 
 	/**
 	 * @brief Runs the FMIP optimization job for a given thread.
@@ -12,6 +12,8 @@
 #ifndef MER_POL_H
 #define MER_POL_H
 
+#include <span>
+
 #include "ACSException.hpp"
 #include "MIP.hpp"
 
@@ -31,10 +33,24 @@ namespace MergePolicy {
 	/**
 	 * @brief Recombines multiple solutions into the given MIP model.
 	 * @param model Reference to the MIP model being modified.
-	 * @param x Vector of solutions to be merged.
+	 * @param x Solutions to be merged.
+	 * @param phase The phase of the recombination process.
+	 * @param extra Further solutions to be merged (e.g. those of the remote workers).
+	 */
+	void recombine(MIP& model, std::span<const Solution> x, const char* phase, std::span<const Solution> extra = {});
+
+	/**
+	 * @brief Stitches the solutions of block neighborhoods into a base solution and adds it to the model
+	 *        as a MIP start (see MIP::addMIPVarsStart). Each block takes its variables from the best
+	 *        solution that freed it; does nothing if no solution comes from a block neighborhood.
+	 * @param model Reference to the MIP model being modified.
+	 * @param base Solution the blocks are stitched into (e.g. the incumbent).
+	 * @param x Solutions to be stitched.
+	 * @param blocks Block freed by each solution (-1: not a block neighborhood).
 	 * @param phase The phase of the recombination process.
+	 * @return Number of blocks stitched.
 	 */
-	void recombine(MIP& model, const std::vector<Solution>& x, const char* phase);
+	size_t stitchBlocks(MIP& model, const std::vector<double>& base, std::span<const Solution> x, std::span<const int> blocks, const char* phase);
 }; // namespace MergePolicy
 
 #endif
\ No newline at end of file
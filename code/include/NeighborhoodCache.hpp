@@ -0,0 +1,183 @@
+/**
+ * @file NeighborhoodCache.hpp
+ * @brief This file defines the NeighborhoodCache class, which remembers the outcome of the
+ *        subMIPs already solved around the current incumbent.
+ *
+ * A subMIP is identified by a 64-bit signature of its kind, of the incumbent version, of the
+ * fixed MIP variables (index and value), of the upper bounds of the slack columns and of the
+ * rows added by the fixing (MIP::getJournalRowsKey). The outcome of its solve is recorded:
+ * infeasible, optimal (with the value of the neighborhood optimum) or stopped by a limit (with
+ * the ticks used). A worker about to solve a neighborhood known to be unproductive (infeasible,
+ * optimal, or limit-reached with no larger budget) redraws its fixings or skips the solve.
+ * Entries of older incumbent versions are dropped.
+ *
+ * @author Francesco Biscaccia Carrara
+ * @version v1.2.11
+ * @since 15/09/2025
+ */
+
+#ifndef NBH_CACHE_H
+#define NBH_CACHE_H
+
+#include <mutex>
+#include <unordered_map>
+
+#include "DetBudget.hpp"
+using namespace Utils;
+
+#pragma region NBH_CACHE_DEF
+
+/** Redraws of the fixings of a known neighborhood before the solve is skipped */
+#define NBH_CACHE_RETRIES 2
+/** Maximum number of entries (the cache is emptied when reached) */
+#define NBH_CACHE_MAX_ENTRIES 65536
+/** Grid on which the fixed values and slack upper bounds are rounded before hashing */
+#define NBH_CACHE_HASH_GRID 1e-6
+
+#pragma endregion
+
+/**
+ * @class NeighborhoodCache
+ * @brief Memo of the subMIP outcomes, keyed by neighborhood signature.
+ *
+ * The class is thread-safe: workers look up their neighborhood before solving it and the
+ * outcome is recorded when the result is committed.
+ */
+class NeighborhoodCache {
+
+public:
+	/**
+	 * @enum Outcome
+	 * @brief Outcome of the solve of a neighborhood.
+	 */
+	enum class Outcome : size_t {
+		Infeasible,
+		Optimal,
+		Limit,
+		_count // Helper for array size
+	};
+
+	/**
+	 * @struct Stats
+	 * @brief Lookups and hits of the cache.
+	 */
+	struct Stats {
+		size_t lookups;													///< Neighborhoods looked up
+		std::array<size_t, static_cast<size_t>(Outcome::_count)> hits; ///< Unproductive neighborhoods found, per recorded outcome
+		size_t perturbed;												///< Fixings redrawn after a hit
+		size_t skipped;													///< Solves skipped (every redraw hit)
+		size_t records;													///< Outcomes recorded
+	};
+
+	/**
+	 * @brief Constructs the cache.
+	 *
+	 * @param enabled If false lookups always miss and nothing is recorded.
+	 */
+	NeighborhoodCache(bool enabled);
+
+	/// Explicitly delete copy constructor and copy assignment operator
+	NeighborhoodCache(const NeighborhoodCache&) = delete;
+	NeighborhoodCache& operator=(const NeighborhoodCache&) = delete;
+
+	/**
+	 * @brief Checks whether the cache is on.
+	 *
+	 * @return True if the cache is used.
+	 */
+	[[nodiscard]]
+	inline bool isEnabled() const noexcept { return enabled; }
+
+	/**
+	 * @brief Computes the signature of a fixed subMIP.
+	 *
+	 * @param model The subMIP, after its fixings.
+	 * @param phase Kind of subMIP.
+	 * @param version Version of the incumbent the subMIP is fixed against.
+	 * @return 64-bit signature of the neighborhood.
+	 */
+	[[nodiscard]]
+	static uint64_t signature(MIP& model, DetBudget::Phase phase, size_t version);
+
+	/**
+	 * @brief Looks up a neighborhood.
+	 *
+	 * @param key Signature of the neighborhood.
+	 * @param version Version of the incumbent.
+	 * @param detTimeLimit Deterministic time limit of the solve about to start.
+	 * @return True if the neighborhood is known to be infeasible or optimal, or stopped by a
+	 *         limit of at least detTimeLimit ticks.
+	 */
+	bool isUnproductive(uint64_t key, size_t version, double detTimeLimit);
+
+	/**
+	 * @brief Records the outcome of a solve.
+	 *
+	 * @param key Signature of the neighborhood.
+	 * @param version Version of the incumbent the subMIP was fixed against.
+	 * @param solveCode Code returned by the solve.
+	 * @param cutoff True if the subMIP had an objective cutoff.
+	 * @param value Objective value of the solution found (CPX_INFBOUND if none).
+	 * @param ticks Deterministic ticks used.
+	 */
+	void record(uint64_t key, size_t version, int solveCode, bool cutoff, double value, double ticks);
+
+	/**
+	 * @brief Counts a redraw of the fixings after a hit.
+	 */
+	void countPerturbed();
+
+	/**
+	 * @brief Counts a skipped solve.
+	 */
+	void countSkipped();
+
+	/**
+	 * @brief Gets the statistics of the cache.
+	 * BE CAREFULL:: use only in a single-thread scenario!
+	 *
+	 * @return Lookups and hits.
+	 */
+	[[nodiscard]]
+	inline const Stats& getStats() const noexcept { return stats; }
+
+	/**
+	 * @brief Gets the name of an outcome.
+	 *
+	 * @param outcome The outcome.
+	 * @return Name of the outcome.
+	 */
+	[[nodiscard]]
+	static const char* outcomeName(Outcome outcome) { return outcomeNames[static_cast<size_t>(outcome)]; }
+
+	~NeighborhoodCache() = default;
+
+private:
+	static constexpr std::array<const char*, static_cast<size_t>(Outcome::_count)> outcomeNames = { "Infeasible", "Optimal", "Limit" };
+
+	/**
+	 * @struct Entry
+	 * @brief Recorded outcome of a neighborhood.
+	 */
+	struct Entry {
+		Outcome outcome; ///< Outcome of the solve
+		double	value;	 ///< Value of the neighborhood optimum (Optimal; CPX_INFBOUND if cut off)
+		double	ticks;	 ///< Deterministic ticks used (Limit)
+	};
+
+	bool								   enabled; ///< Cache flag
+	size_t								   version; ///< Incumbent version of the entries
+	std::unordered_map<uint64_t, Entry>	   entries; ///< Outcomes of the neighborhoods of the current version
+	Stats								   stats;	///< Lookups and hits
+	std::mutex							   cacheMTX; ///< Mutex for synchronizing lookups and records
+
+	/**
+	 * @brief Drops the entries of the older incumbent versions (cacheMTX held).
+	 *
+	 * @param newVersion Version of the incumbent of the caller.
+	 * @return False if newVersion is older than the entries.
+	 */
+	bool syncVersion(size_t newVersion);
+};
+
+#endif
@@ -0,0 +1,193 @@
+/**
+ * @file PolicyPortfolio.hpp
+ * @brief This file defines the PolicyPortfolio class, which chooses the fixing policy
+ *        each ACS worker applies to its subMIP.
+ *
+ * The policies of the portfolio are raced concurrently: at the start of every parallel
+ * phase each worker draws one of them from a multi-armed bandit (UCB rule), whose reward
+ * is the slack (FMIP) or objective (OMIP) improvement per second of the subMIPs fixed
+ * with that policy. Workers thus drift toward the policies that work on the instance.
+ * Usage, rewards and deterministic ticks are kept per phase and per policy; with the
+ * portfolio off a single policy is used, which makes the policies easy to benchmark.
+ * LP-guided policies are arms only once the root LP has been cached (FixPolicy::solveRootLP),
+ * the block policy only once a block structure has been found (FixPolicy::detectBlocks).
+ *
+ * @author Francesco Biscaccia Carrara
+ * @version v1.2.11
+ * @since 15/09/2025
+ */
+
+#ifndef POLICY_PORTFOLIO_H
+#define POLICY_PORTFOLIO_H
+
+#include <mutex>
+
+#include "DetBudget.hpp"
+using namespace Utils;
+
+#pragma region POLICY_PORTFOLIO_DEF
+
+/** Exploration weight of the UCB rule */
+#define PORTFOLIO_UCB_C 0.5
+
+#pragma endregion
+
+/**
+ * @class PolicyPortfolio
+ * @brief Thread-safe bandit over the fixing policies of the subMIPs.
+ */
+class PolicyPortfolio {
+
+public:
+	/**
+	 * @enum Policy
+	 * @brief Fixing policies of the portfolio.
+	 */
+	enum class Policy : size_t {
+		RandomRho,	// Contiguous window of rho * n variables (FixPolicy::randomRhoFixMT)
+		UniformRho, // rho * n variables drawn uniformly (FixPolicy::uniformRhoFixMT)
+		WalkMIP,	// Violation-driven moves, then a window (FixPolicy::walkMIPMT) -- FMIP only
+		GraphBFS,	// Connected free set by BFS on the variable-constraint graph (FixPolicy::graphBFSFixMT)
+		GraphWalk,	// Connected free set by random walks on the graph (FixPolicy::graphWalkFixMT)
+		RINS,		// Variables agreeing with the root LP fixed first (FixPolicy::rinsFixMT) -- root LP needed
+		RedCost,	// Variables with the largest root LP reduced costs (FixPolicy::redCostFixMT) -- root LP needed
+		Block,		// One block of the decomposition free, the others fixed (FixPolicy::blockFixMT) -- blocks needed
+		LocalBranch, // Hamming ball around the reference as a single row, no fixing (FixPolicy::localBranchMT)
+		_count		// Helper for array size
+	};
+
+	/**
+	 * @struct PolicyStats
+	 * @brief Statistics of a policy within a phase.
+	 */
+	struct PolicyStats {
+		size_t picks;		///< Number of subMIPs the policy has been drawn for
+		size_t solves;		///< Number of recorded solves
+		double improvement; ///< Sum of the relative improvements
+		double cost;		///< Seconds (deterministic ticks in deterministic mode) spent
+		double ticks;		///< Deterministic ticks of the solves
+		size_t infeasible;	///< Solves returned without solution (infeasible or pruned by the cutoff)
+	};
+
+	/**
+	 * @brief Constructs the portfolio.
+	 *
+	 * @param enabled If false every subMIP is fixed with the fixed policy.
+	 * @param deterministic If true rewards are measured per deterministic tick instead of per second.
+	 * @param fixed Index of the policy used when the portfolio is off (Policy::RandomRho where
+	 *              not available).
+	 */
+	PolicyPortfolio(bool enabled, bool deterministic = false, size_t fixed = 0);
+
+	/// Explicitly delete copy constructor and copy assignment operator
+	PolicyPortfolio(const PolicyPortfolio&) = delete;
+	PolicyPortfolio& operator=(const PolicyPortfolio&) = delete;
+
+	/**
+	 * @brief Draws the policy of a new subMIP.
+	 *
+	 * @param phase Kind of subMIP (DetBudget::Phase::FMIP or DetBudget::Phase::OMIP).
+	 * @return Policy to apply.
+	 */
+	Policy pick(DetBudget::Phase phase);
+
+	/**
+	 * @brief Records the outcome of a subMIP.
+	 *
+	 * @param phase Kind of subMIP.
+	 * @param policy Policy the subMIP has been fixed with.
+	 * @param improvement Relative improvement obtained (see DetBudget::improvement).
+	 * @param wallTime Wall time (in seconds) of fixing and solve.
+	 * @param ticks Deterministic ticks of the solve.
+	 * @param infeasible True if the solve returned no solution.
+	 */
+	void record(DetBudget::Phase phase, Policy policy, double improvement, double wallTime, double ticks, bool infeasible);
+
+	/**
+	 * @brief Applies the fixings of a policy to a subMIP.
+	 *
+	 * @param policy Fixing policy.
+	 * @param thID ID of the thread running the job.
+	 * @param type Type of subMIP ("FMIP" or "OMIP").
+	 * @param model The subMIP to fix.
+	 * @param refSol The solution the variables are fixed to.
+	 * @param prevRefSol The previous reference solution of the worker (graph policies, may be empty).
+	 * @param rho Fraction of the variables to fix.
+	 * @param block Block left free by the block policy (index in FixPolicy::getBlocks).
+	 * @param rnd Random number generator of the worker.
+	 */
+	static void apply(Policy policy, const size_t thID, const char* type, MIP& model, const std::vector<double>& refSol, const std::vector<double>& prevRefSol, double rho, size_t block, Random& rnd);
+
+	/**
+	 * @brief Sets the walk probability of the WalkMIP policy (DEF_WALK_PROB by default).
+	 *        Call it before the workers start.
+	 *
+	 * @param p Probability of a random move, within (0,1).
+	 */
+	static void setWalkProb(double p);
+
+	/**
+	 * @brief Gets the statistics of the policies of a phase.
+	 * BE CAREFULL:: use only in a single-thread scenario!
+	 *
+	 * @param phase Kind of subMIP.
+	 * @return Array of policy statistics (indexed by Policy).
+	 */
+	[[nodiscard]]
+	inline const std::array<PolicyStats, static_cast<size_t>(Policy::_count)>& getStats(DetBudget::Phase phase) { return stats[static_cast<size_t>(phase)]; }
+
+	/**
+	 * @brief Checks whether the portfolio is on.
+	 *
+	 * @return True if policies are drawn by the bandit.
+	 */
+	[[nodiscard]]
+	inline bool isEnabled() const noexcept { return enabled; }
+
+	/**
+	 * @brief Checks whether a policy can be drawn in a phase.
+	 *
+	 * WalkMIP moves toward the violated constraints of the reference solution: OMIP references
+	 * are usually feasible, hence the policy is FMIP only. LP-guided policies need the root LP
+	 * (FixPolicy::solveRootLP), the block policy a decomposition (FixPolicy::detectBlocks).
+	 *
+	 * @param phase Kind of subMIP.
+	 * @param policy Policy to check.
+	 * @return True if the policy is an arm of the phase.
+	 */
+	[[nodiscard]]
+	static bool isAvailable(DetBudget::Phase phase, Policy policy);
+
+	/**
+	 * @brief Checks whether a policy uses the root LP relaxation.
+	 *
+	 * @param policy Fixing policy.
+	 * @return True for the LP-guided policies.
+	 */
+	[[nodiscard]]
+	static bool isLPGuided(Policy policy) { return policy == Policy::RINS || policy == Policy::RedCost; }
+
+	/**
+	 * @brief Gets the name of a policy.
+	 *
+	 * @param policy Fixing policy.
+	 * @return Name of the policy.
+	 */
+	[[nodiscard]]
+	static const char* policyName(Policy policy) { return policyNames[static_cast<size_t>(policy)]; }
+
+private:
+	static constexpr size_t NUM_PHASES{ static_cast<size_t>(DetBudget::Phase::_count) };
+	static constexpr size_t NUM_POLICIES{ static_cast<size_t>(Policy::_count) };
+
+	/// Static array of policy names
+	static constexpr std::array<const char*, NUM_POLICIES> policyNames = { "RandomRho", "UniformRho", "WalkMIP", "GraphBFS", "GraphWalk", "RINS", "RedCost", "Block", "LocalBranch" };
+
+	std::array<std::array<PolicyStats, NUM_POLICIES>, NUM_PHASES> stats;		 ///< Statistics per phase and policy
+	bool														  enabled;		 ///< Portfolio flag
+	Policy														  fixed;		 ///< Policy used when the portfolio is off
+	bool														  deterministic; ///< True if costs are deterministic ticks
+	std::mutex													  portfolioMTX;	 ///< Mutex for synchronizing the statistics
+};
+
+#endif
@@ -0,0 +1,152 @@
+/**
+ * @file Propagator.hpp
+ * @brief This file defines the Propagator class, an activity-based bound propagation run on the
+ *        fixed subMIPs before they are passed to CPLEX.
+ *
+ * For every constraint of the original MIP (shared CSR), the minimum and maximum activities over
+ * the current bounds (slack columns of FMIP/OMIP included) prove the infeasibility of the fixings
+ * or tighten the bounds of the free variables; the rows of a tightened variable are processed
+ * again, within a work budget. No CPLEX call is made but the two reading the bounds and the one
+ * passing the tightened integer bounds to the model.
+ *
+ * @author Francesco Biscaccia Carrara
+ * @version v1.2.11
+ * @since 15/09/2025
+ */
+
+#ifndef PROPAGATOR_H
+#define PROPAGATOR_H
+
+#include <atomic>
+
+#include "MIP.hpp"
+using namespace Utils;
+
+#pragma region PROPAGATOR_DEF
+
+/** Relative violation of a constraint (on its minimum or maximum activity) proving infeasibility */
+#define PROP_FEAS_TOL 1e-6
+/** Tolerance of the rounding of the bounds of integer variables */
+#define PROP_INT_TOL 1e-6
+/** Minimum relative tightening of the bound of a continuous variable */
+#define PROP_MIN_TIGHTEN 1e-3
+/** Work budget of a propagation, in multiples of the non-zeros of the MIP */
+#define PROP_WORK_FACTOR 4
+/** Redraws of an infeasible fixing before the solve is skipped */
+#define PROP_RETRIES 2
+
+#pragma endregion
+
+/**
+ * @class Propagator
+ * @brief Domain propagation over the shared constraint matrix of the MIP.
+ *
+ * The class is thread-safe: the instance data are read-only after construction and every
+ * propagation works on its own bound vectors.
+ */
+class Propagator {
+
+public:
+	/**
+	 * @struct Result
+	 * @brief Outcome of a propagation.
+	 */
+	struct Result {
+		bool   infeasible;	///< True if the bounds admit no solution
+		int	   conflictRow; ///< Constraint proving the infeasibility (-1 if none)
+		size_t tightened;	///< Integer bounds tightened and passed to the model
+	};
+
+	/**
+	 * @brief Loads variable types and the shared constraint matrix of the instance.
+	 *
+	 * @param fileName Name of the instance.
+	 */
+	Propagator(const std::string& fileName);
+
+	/// Explicitly delete copy constructor and copy assignment operator
+	Propagator(const Propagator&) = delete;
+	Propagator& operator=(const Propagator&) = delete;
+
+	/**
+	 * @brief Propagates the bounds of a model: tightened integer bounds are set on it (one CPXchgbds
+	 *        call, recorded by the bound journal), infeasibility is only reported.
+	 *
+	 * @param model The model (MIP, FMIP or OMIP of the instance).
+	 * @return Outcome of the propagation.
+	 */
+	Result propagate(MIP& model);
+
+	/**
+	 * @brief Gets the number of propagations.
+	 *
+	 * @return Number of calls of Propagator::propagate.
+	 */
+	[[nodiscard]]
+	inline size_t getNumRuns() const noexcept { return A_Runs; }
+
+	/**
+	 * @brief Gets the number of infeasible fixings found, i.e. of CPLEX solves avoided.
+	 *
+	 * @return Number of propagations proving infeasibility.
+	 */
+	[[nodiscard]]
+	inline size_t getNumInfeasible() const noexcept { return A_Infeasible; }
+
+	/**
+	 * @brief Gets the number of integer bounds tightened.
+	 *
+	 * @return Bounds tightened over all the propagations.
+	 */
+	[[nodiscard]]
+	inline size_t getNumTightened() const noexcept { return A_Tightened; }
+
+	~Propagator() = default;
+
+private:
+	/**
+	 * @struct Activity
+	 * @brief Minimum and maximum activity of a constraint.
+	 */
+	struct Activity {
+		double min;	   ///< Minimum activity (finite contributions only)
+		double max;	   ///< Maximum activity (finite contributions only)
+		size_t minInf; ///< Infinite contributions to the minimum activity
+		size_t maxInf; ///< Infinite contributions to the maximum activity
+	};
+
+	size_t								  numVars;	   ///< Number of MIP variables
+	size_t								  numRows;	   ///< Number of constraints
+	const std::vector<int>&				  rowBeg;	   ///< CSR row starts (shared MIP data)
+	const std::vector<int>&				  rowInd;	   ///< CSR column indices (shared MIP data)
+	const std::vector<double>&			  rowVal;	   ///< CSR values (shared MIP data)
+	const std::vector<char>&			  sense;	   ///< Constraint senses (shared MIP data)
+	const std::vector<double>&			  rhs;		   ///< Right-hand sides (shared MIP data)
+	const std::vector<std::vector<int>>&  varToConstr; ///< Constraints of each variable (shared MIP data)
+	std::vector<char>					  isInt;	   ///< 1 for binary and integer variables
+
+	std::atomic_size_t A_Runs{ 0 };		  ///< Propagations run
+	std::atomic_size_t A_Infeasible{ 0 }; ///< Propagations proving infeasibility
+	std::atomic_size_t A_Tightened{ 0 };  ///< Integer bounds tightened
+
+	/**
+	 * @brief Reads the data of the instance from a model of it.
+	 *
+	 * @param model The MIP (only used during construction).
+	 */
+	Propagator(MIP&& model);
+
+	/**
+	 * @brief Computes the activity bounds of a constraint.
+	 *
+	 * @param c Index of the constraint.
+	 * @param lb Lower bounds.
+	 * @param ub Upper bounds.
+	 * @param hasSlacks True if the bounds include the slack columns of FMIP/OMIP.
+	 * @return Activity bounds of the constraint.
+	 */
+	[[nodiscard]]
+	Activity activity(const size_t c, const std::vector<double>& lb, const std::vector<double>& ub, const bool hasSlacks) const;
+};
+
+#endif
@@ -0,0 +1,135 @@
+/**
+ * @file RhoController.hpp
+ * @brief This file defines the RhoController class, which adapts the fixing ratio rho of
+ *        each worker to the outcome of its own subMIPs.
+ *
+ * Every worker slot owns a rho and a step size. A subMIP solved to optimality (the neighborhood
+ * was too small) lowers rho, one stopped by the time limit (too large) raises it: the moves are
+ * weighted so that rho stays still when a fraction RHO_TARGET of the solves completes. A search
+ * proven without improving solutions by the cutoff lowers rho as well (the whole neighborhood has
+ * been explored) but is counted apart from the optimal solves. The step
+ * grows while the moves keep the same direction and shrinks when they alternate. Improving
+ * solves leave rho unchanged. Each slot is written only by the thread committing its results,
+ * so no lock is taken: the other threads only read the atomic rho of the slots.
+ *
+ * @author Francesco Biscaccia Carrara
+ * @version v1.2.11
+ * @since 15/09/2025
+ */
+
+#ifndef RHO_CONTROLLER_H
+#define RHO_CONTROLLER_H
+
+#include <atomic>
+
+#include "FixPolicy.hpp"
+using namespace Utils;
+
+#pragma region RHO_CONTROLLER_DEF
+
+/** Target fraction of the subMIPs solved to optimality */
+#define RHO_TARGET 0.5
+/** Initial step size of rho */
+#define RHO_STEP_INIT (2 * DELTA_RHO)
+/** Minimum step size of rho */
+#define RHO_STEP_MIN 5e-3
+/** Maximum step size of rho */
+#define RHO_STEP_MAX 0.4
+/** Step growth when two consecutive moves have the same direction */
+#define RHO_STEP_GROW 1.2
+/** Step shrink when two consecutive moves have opposite directions */
+#define RHO_STEP_SHRINK 0.5
+
+#pragma endregion
+
+/**
+ * @class RhoController
+ * @brief Per-worker step-size adaptation of rho.
+ *
+ * RhoController::record on a slot must be called by one thread at a time (the worker, or the
+ * main thread in deterministic mode); the rho of every slot can be read by any thread.
+ */
+class RhoController {
+
+public:
+	/**
+	 * @struct Sample
+	 * @brief Point of the rho trajectory of a worker.
+	 */
+	struct Sample {
+		double time; ///< Wall time since the start of ACS
+		double rho;	 ///< Rho after the solve
+		int	   move; ///< Direction of the change: -1, 0 or +1
+	};
+
+	/**
+	 * @struct WorkerStats
+	 * @brief State and statistics of a worker slot.
+	 */
+	struct WorkerStats {
+		std::atomic<double> rho;		///< Current rho
+		double				step;		///< Current step size
+		int					lastMove;	///< Direction of the last change (0: none yet)
+		size_t				solves;		///< Solves recorded
+		size_t				complete;	///< Solves ended at optimality
+		size_t				noImprove;	///< Solves proven without improving solutions (cutoff)
+		size_t				limits;		///< Solves ended by the time limit
+		std::vector<Sample> trajectory; ///< Rho after each solve
+	};
+
+	/**
+	 * @brief Constructs the controller.
+	 *
+	 * @param numWorkers Number of worker slots.
+	 * @param initRho Initial rho of every slot.
+	 */
+	RhoController(size_t numWorkers, double initRho);
+
+	/// Explicitly delete copy constructor and copy assignment operator
+	RhoController(const RhoController&) = delete;
+	RhoController& operator=(const RhoController&) = delete;
+
+	/**
+	 * @brief Gets the rho of a worker.
+	 *
+	 * @param thID Worker slot.
+	 * @return Fraction of the variables the worker fixes.
+	 */
+	[[nodiscard]]
+	inline double getRho(const size_t thID) const { return workers[thID].rho.load(std::memory_order_relaxed); }
+
+	/**
+	 * @brief Gets the mean rho of the first worker slots.
+	 *
+	 * @param numWorkers Number of slots averaged (the active workers).
+	 * @return Mean rho.
+	 */
+	[[nodiscard]]
+	double getMeanRho(size_t numWorkers) const;
+
+	/**
+	 * @brief Adapts the rho of a worker to the outcome of its subMIP.
+	 *
+	 * @param thID Worker slot.
+	 * @param type String that define the kind of subMIP.
+	 * @param solveCode Code returned by CPXmipopt (cutoff codes already translated).
+	 * @param improvement Relative improvement obtained (see DetBudget::improvement).
+	 */
+	void record(const size_t thID, const char* type, const int solveCode, const double improvement);
+
+	/**
+	 * @brief Gets the state and the trajectory of every worker slot.
+	 * BE CAREFULL:: use only in a single-thread scenario!
+	 *
+	 * @return Statistics of the slots.
+	 */
+	[[nodiscard]]
+	inline const std::vector<WorkerStats>& getStats() const { return workers; }
+
+	~RhoController() = default;
+
+private:
+	std::vector<WorkerStats> workers; ///< State of each worker slot.
+};
+
+#endif
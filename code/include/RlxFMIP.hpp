@@ -100,6 +100,8 @@ public:
 	 * This method solves a relaxed version of the original problem,
 	 * typically by relaxing integrality constraints, to obtain bounds
 	 * on the optimal solution or to improve solution speed.
+	 * The first call turns the model into an LP; later calls (e.g. after bound changes)
+	 * re-optimize it with the dual simplex from the basis of the previous solve.
 	 *
 	 * @param timeLimit Maximum wall clock time for the solution process (default: CPX_INFBOUND).
 	 * @return Status code indicating the result of the relaxation solution process.
@@ -123,10 +125,12 @@ private:
 	 * @brief Vector to store original variable types.
 	 *
 	 * This member variable maintains the original types of variables
-	 * to allow restoration after relaxation operations.
+	 * (read once, at construction) to allow restoration after relaxation operations.
 	 */
 	std::vector<char> restoreVarType;
 
+	bool relaxed{ false }; ///< True while the model is an LP (basis kept between solveRelaxation calls)
+
 	/**
 	 * @brief Changes the problem type.
 	 *
@@ -12,20 +12,24 @@
 
 #include <algorithm>
 #include <array>
+#include <bit>
 #include <chrono>
 #include <cmath>
 #include <cstdarg>
+#include <cstdint>
 #include <cstdio>
 #include <cstdlib>
 #include <ctime>
 #include <fstream>
 #include <iostream>
+#include <limits>
 #include <numeric>
 #include <random>
 #include <set>
 #include <sstream>
 #include <stdexcept>
 #include <string>
+#include <thread>
 #include <vector>
 
 #include <string.h>
@@ -57,7 +61,7 @@
 
 #define DEF_TL 60.0
 #define DEF_RHO 0.1
-#define DEF_WALK_PROB 0.7
+#define DEF_WALK_PROB 0.1
 #define DEF_SUBMIPS 4
 #pragma endregion
 
@@ -109,6 +113,30 @@ namespace Utils {
 		double			   rho;		   ///< Rho parameter
 		unsigned long	   numsubMIPs; ///< Number of sub-MIPs
 		unsigned long long seed;	   ///< Random number generator see
+		unsigned long	   algo;	   ///< Algorithm variant (label of the run)
+		unsigned long	   numCores;   ///< Core budget shared by CPLEX threads
+		unsigned long	   pin;		   ///< Pin workers to NUMA-local cores (0: off, 1: on)
+		unsigned long	   pipeline;   ///< Prepare the next subMIPs during the merge MIPs (0: off, 1: on)
+		unsigned long	   elastic;	   ///< Change the number of subMIPs between rounds (0: off, 1: on)
+		unsigned long	   deterministic; ///< Reproducible parallel execution (0: off, 1: on)
+		unsigned long	   portfolio;  ///< Draw the fixing policy of each subMIP from a bandit (0: off, 1: on)
+		unsigned long	   fixPolicy;  ///< Fixing policy used when the portfolio is off
+		unsigned long	   coordinator; ///< TCP port of the coordinator of a distributed run (0: off)
+		unsigned long	   numRemote;  ///< Number of worker processes the coordinator waits for
+		unsigned long	   worker;	   ///< Run as worker of the coordinator on this TCP port (0: off)
+		std::string		   host;	   ///< Host of the coordinator (worker mode)
+		double			   feasJump;   ///< Wall time (seconds) of the Feasibility Jump pre-phase (0: off)
+		unsigned long	   multiStart; ///< One diverse starting vector per worker slot (0: off, 1: on)
+		unsigned long	   elitePool;  ///< Capacity of the elite solution pool (0: off)
+		unsigned long	   nbhCache;   ///< Skip the subMIPs whose neighborhood outcome is known (0: off, 1: on)
+		unsigned long	   propagate;  ///< Bound propagation of the fixed subMIPs (0: off, 1: on)
+		double			   rhoCont;	   ///< Fraction of the continuous variables fixed with the integer ones
+		unsigned long	   improve;	   ///< OMIP phases without improvement before stopping once feasible (0: stop at the first feasible solution)
+		unsigned long	   autoConfig; ///< Pick rho, numsubMIPs, fixing policy and DET_TL scale from the instance features (0: off, 1: on)
+		std::string		   autoRules;  ///< Rules file of the automatic configuration (empty: built-in table)
+		double			   walkProb;   ///< Walk probability of the WalkMIP fixing policy
+		double			   detScale;   ///< Base scale of the deterministic time limits DET_TL(nnz)
+		std::string		   resultFile; ///< JSON file the outcome of the run is written to (empty: off)
 	};
 
 	/**
@@ -226,6 +254,66 @@ namespace Utils {
 		double timeRemaining(const double timeLimit);
 	}; // namespace Clock
 
+	namespace Hash {
+
+		/** FNV-1a offset basis (hash of nothing) */
+		constexpr uint64_t OFFSET{ 14695981039346656037ULL };
+		/** FNV-1a prime */
+		constexpr uint64_t PRIME{ 1099511628211ULL };
+
+		/**
+		 * Mixes the 8 bytes of a value into a 64-bit FNV-1a hash.
+		 *
+		 * @param h Current hash
+		 * @param v Value to mix
+		 * @return Updated hash
+		 */
+		inline uint64_t mix(uint64_t h, const uint64_t v) {
+			for (size_t b{ 0 }; b < sizeof(v); b++) {
+				h ^= (v >> (8 * b)) & 0xFF;
+				h *= PRIME;
+			}
+			return h;
+		}
+
+		/**
+		 * Mixes a real value, rounded on a grid, into a 64-bit FNV-1a hash.
+		 *
+		 * @param h Current hash
+		 * @param v Value to mix
+		 * @param grid Rounding grid (values closer than it usually hash alike)
+		 * @return Updated hash
+		 */
+		inline uint64_t mix(uint64_t h, const double v, const double grid) {
+			// + 0.0 maps -0.0 to 0.0
+			return mix(h, std::bit_cast<uint64_t>(std::round(v / grid) + 0.0));
+		}
+	}; // namespace Hash
+
+	namespace UCB {
+
+		/**
+		 * Statistics of an arm of a UCB bandit.
+		 */
+		struct Arm {
+			size_t picks;	  ///< Times the arm has been picked
+			size_t solves;	  ///< Outcomes recorded
+			double gain;	  ///< Total gain of the outcomes
+			double cost;	  ///< Total cost of the outcomes
+			bool   available; ///< False if the arm cannot be picked
+		};
+
+		/**
+		 * Picks an arm with the UCB1 rule on the gain per cost, normalized by the best arm.
+		 * Arms never picked are returned first, in order.
+		 *
+		 * @param arms Statistics of the arms
+		 * @param c Exploration weight
+		 * @return Index of the arm (0 if none is available)
+		 */
+		size_t pick(const std::vector<Arm>& arms, const double c);
+	}; // namespace UCB
+
 	/**
 	 * Custom exception for command-line argument parsing errors.
 	 */
@@ -10,7 +10,11 @@
 #include <iostream>
 #include <nlohmann/json.hpp>
 
+#include "../include/AutoConfig.hpp"
+#include "../include/DetBudget.hpp"
+#include "../include/Distributed.hpp"
 #include "../include/FMIP.hpp"
+#include "../include/FeasJump.hpp"
 #include "../include/FixPolicy.hpp"
 #include "../include/MTContext.hpp"
 #include "../include/MergePolicy.hpp"
@@ -25,21 +29,123 @@ int main(int argc, char* argv[]) {
 	try {
 		Clock::initTime = Clock::getTime();
 
-		Args	  CLIArgs = CLIParser(argc, argv).getArgs();
-		MTContext MTEnv(CLIArgs.numsubMIPs, CLIArgs.seed);
+		Args CLIArgs = CLIParser(argc, argv).getArgs();
+		FixPolicy::setContinuousRho(CLIArgs.rhoCont);
+		PolicyPortfolio::setWalkProb(CLIArgs.walkProb);
+
+		// Worker process of a distributed run: serve the coordinator, then quit
+		if (CLIArgs.worker) {
+			DistWorker(CLIArgs).run();
+			return EXIT_SUCCESS;
+		}
+
+		// Instance features are computed once, with the shared data of the original MIP
+		InstanceFeatures features{ MIP(CLIArgs.fileName).getMIPFeatures() };
+		PRINT_OUT("Features -- Rows: %zu -- Cols: %zu -- NNZ: %zu [density: %.2e] -- Bin/Int/Cont: %.3f/%.3f/%.3f -- Row length: %.2f +- %.2f [%zu - %zu] -- Equality rows: %.3f", features.rows, features.cols, features.nnz,
+				  features.density, features.binFrac, features.intFrac, features.contFrac, features.rowLenMean, features.rowLenStd, features.rowLenMin, features.rowLenMax, features.eqFrac);
+
+		// Automatic configuration: the rule table overrides the CLI parameters before anything is built
+		std::unique_ptr<AutoConfig> autoConfig;
+		AutoConfig::Config			config{ .rho = CLIArgs.rho, .numsubMIPs = CLIArgs.numsubMIPs, .fixPolicy = CLIArgs.fixPolicy, .detScale = CLIArgs.detScale, .matched = {} };
+		if (CLIArgs.autoConfig) {
+			autoConfig = std::make_unique<AutoConfig>(CLIArgs.autoRules);
+			config = autoConfig->select(features, CLIArgs);
+			CLIArgs.rho = config.rho;
+			CLIArgs.numsubMIPs = config.numsubMIPs;
+			CLIArgs.fixPolicy = config.fixPolicy;
+			PRINT_OUT("AutoConfig -- Rules matched: %zu/%zu -- Rho: %5.4f -- SubMIPs: %zu -- Fixing policy: %s%s -- DET_TL scale: %4.2f", config.matched.size(), autoConfig->getNumRules(), config.rho, config.numsubMIPs,
+					  PolicyPortfolio::policyName(static_cast<PolicyPortfolio::Policy>(config.fixPolicy)), CLIArgs.portfolio ? " (portfolio on: unused)" : "", config.detScale);
+		}
+
+		MTContext MTEnv(CLIArgs.numsubMIPs, CLIArgs.seed, CLIArgs.numCores, CLIArgs.pin, CLIArgs.elastic, CLIArgs.deterministic, CLIArgs.portfolio, CLIArgs.fixPolicy, CLIArgs.elitePool, CLIArgs.nbhCache, CLIArgs.rho);
+		MTEnv.getDetBudget().setBaseScale(config.detScale);
+		MTEnv.getElitePool().loadVarTypes(CLIArgs.fileName);
+		if (CLIArgs.propagate)
+			MTEnv.enablePropagation(CLIArgs.fileName);
 
 		std::vector<double> startSol;
 		Random				mainRnd = Random(CLIArgs.seed);
 
-		PRINT_INFO("ACS -- Dyn_Rho_Adjustment - Init_Rho : %3.2f - Init_Sol : MaxFeas",CLIArgs.rho);
-		FixPolicy::startSolMaxFeas(startSol, CLIArgs.fileName, mainRnd);
+		std::unique_ptr<DistCoordinator> coordinator;
+		if (CLIArgs.coordinator)
+			coordinator = std::make_unique<DistCoordinator>(CLIArgs.coordinator, CLIArgs.numRemote, CLIArgs.fileName);
+
+		// Wall time of the remote jobs of a phase: their DET_TL at the local tick rate, so that a worker
+		// that does not answer delays the recombination by DIST_GRACE_TL past the phase at most
+		auto remoteTimeLimit = [&](DetBudget::Phase phase) {
+			double rate{ MTEnv.getDetBudget().getTickRate(phase) };
+			double detTL{ std::clamp(MTEnv.getDetBudget().getBaseScale() * DET_TL(features.nnz + 2 * features.rows), MIN_DET_TL, MAX_DET_TL) };
+			double phaseTL{ (rate > EPSILON) ? DIST_TL_SLACK * detTL / rate : DIST_PHASE_TL_FRAC * CLIArgs.timeLimit };
+			return std::min(phaseTL, Clock::timeRemaining(CLIArgs.timeLimit));
+		};
+
+		// Remote subMIPs run alongside the local ones: their solutions join the recombination
+		auto collectRemote = [&]() -> std::span<const Solution> {
+			if (!coordinator)
+				return {};
+			coordinator->collect(MTEnv.getPolicyPortfolio());
+			for (const Solution& sol : coordinator->getSolutions()) {
+				MTEnv.setBestACSIncumbent(sol);
+				MTEnv.getElitePool().insert(sol);
+			}
+			return coordinator->getSolutions();
+		};
+
+		PRINT_INFO("ACS -- Dyn_Rho_Adjustment - Init_Rho : %3.2f - Init_Sol : %s", CLIArgs.rho, CLIArgs.multiStart ? "MultiStart" : "MaxFeas");
+		// Multi-start: one diverse vector per worker slot, built in parallel
+		std::vector<std::vector<double>> startSols;
+		if (CLIArgs.multiStart) {
+			startSols = FixPolicy::startSolPool(CLIArgs.fileName, MTEnv.getNumMIPs(), CLIArgs.timeLimit, static_cast<unsigned long long>(mainRnd.Int(0, INT_MAX)));
+			startSol = startSols.front();
+		} else {
+			FixPolicy::startSolMaxFeas(startSol, CLIArgs.fileName, mainRnd);
+			startSols.push_back(startSol);
+		}
+
+		// LP-guided fixing: the root LP is solved once, workers read the cached solution and reduced costs
+		if (CLIArgs.portfolio || PolicyPortfolio::isLPGuided(static_cast<PolicyPortfolio::Policy>(CLIArgs.fixPolicy)))
+			FixPolicy::solveRootLP(CLIArgs.fileName, Clock::timeRemaining(CLIArgs.timeLimit) * ROOT_LP_TL_FRAC);
+
+		// Block fixing: the decomposition is found once, workers free one block each
+		const FixPolicy::Blocks& blocks{ FixPolicy::getBlocks() };
+		size_t					 numStitched{ 0 };
+		if (CLIArgs.portfolio || static_cast<PolicyPortfolio::Policy>(CLIArgs.fixPolicy) == PolicyPortfolio::Policy::Block) {
+			FixPolicy::detectBlocks(CLIArgs.fileName);
+			PRINT_OUT("Blocks: %zu -- Components: %zu -- Linking rows: %zu", blocks.vars.size(), blocks.numComps, blocks.numLinks);
+		}
 
 #if ACS_VERBOSE >= VERBOSE
 		PRINT_INFO("Starting vector found!");
 #endif
 
 		Solution tmpSol = { .sol = startSol, .slackSum = CPX_INFBOUND, .oMIPCost = CPX_INFBOUND };
-		MTEnv.broadcastSol(tmpSol);
+		if (CLIArgs.multiStart || CLIArgs.feasJump > EPSILON) {
+			// Starting vectors and local search (FeasJump) outputs are ranked by violation: the best one
+			// is the first incumbent, the others seed the workers (possibly already feasible)
+			FeasJump			  feasJump(CLIArgs.fileName);
+			std::vector<Solution> seeds;
+			if (CLIArgs.multiStart)
+				for (const auto& sol : startSols)
+					seeds.push_back(feasJump.evaluate(sol));
+			if (CLIArgs.feasJump > EPSILON) {
+				std::vector<Solution> fjSols{ feasJump.run(startSols, std::max<size_t>(CLIArgs.numCores, MTEnv.getNumMIPs()), std::min(CLIArgs.feasJump, Clock::timeRemaining(CLIArgs.timeLimit)),
+															   static_cast<unsigned long long>(mainRnd.Int(0, INT_MAX)), MTEnv.isDeterministic()) };
+				PRINT_OUT("FeasJump Objective: %20.2f", fjSols.front().slackSum);
+				seeds.insert(seeds.end(), fjSols.begin(), fjSols.end());
+			}
+			std::stable_sort(seeds.begin(), seeds.end(), [](const Solution& a, const Solution& b) { return a.slackSum < b.slackSum; });
+
+			tmpSol = seeds.front();
+			MTEnv.setBestACSIncumbent(tmpSol);
+			for (const Solution& sol : seeds)
+				MTEnv.getElitePool().insert(sol);
+			MTEnv.seedSolutions(std::span<const Solution>(seeds.data(), std::min(seeds.size(), MTEnv.getNumMIPs())));
+		} else
+			MTEnv.broadcastSol(tmpSol);
+
+		// Improvement mode: OMIP phases go on after the first feasible solution, until a stall
+		size_t numStallPhases{ 0 };
+		size_t numImprovePhases{ 0 };
 
 		while (Clock::timeElapsed() < CLIArgs.timeLimit) {
 			if (std::abs(MTEnv.getBestACSIncumbent().slackSum) > EPSILON) {
@@ -51,13 +157,21 @@ int main(int argc, char* argv[]) {
 					break;
 				}
 				// PARALLEL FMIP Phase
+				if (coordinator)
+					coordinator->dispatch(DetBudget::Phase::FMIP, tmpSol, MTEnv.getBestACSIncumbent(), CLIArgs.rho, MTEnv.getPolicyPortfolio(), mainRnd, remoteTimeLimit(DetBudget::Phase::FMIP));
 				MTEnv.parallelFMIPOptimization(CLIArgs);
+				std::span<const Solution> remoteSols{ collectRemote() };
 
 				// 1° Recombination phase
-				FMIP MergeFMIP(CLIArgs.fileName);
-				MergeFMIP.setNumCores(CPLEX_CORE);
+				double setupTime{ Clock::getTime() };
+				FMIP   MergeFMIP(CLIArgs.fileName);
+				MergeFMIP.setNumCores(MTEnv.getNumCores());
+				if (MTEnv.isDeterministic())
+					MergeFMIP.setDeterministic();
+				MTEnv.setFMIPObjLimits(MergeFMIP);
 
-				MergePolicy::recombine(MergeFMIP, MTEnv.getTmpSolutions(), "1_Phase");
+				MergePolicy::recombine(MergeFMIP, MTEnv.getMergeSolutions(), "1_Phase", remoteSols);
+				numStitched += MergePolicy::stitchBlocks(MergeFMIP, MTEnv.getBestACSIncumbent().sol, MTEnv.getTmpSolutions(), MTEnv.getWorkerBlocks(), "1_Phase");
 
 				if (MTEnv.getBestACSIncumbent().slackSum < CPX_INFBOUND) {
 					MergeFMIP.addMIPStart(MTEnv.getBestACSIncumbent().sol);
@@ -71,22 +185,42 @@ int main(int argc, char* argv[]) {
 					break;
 				}
 
-				int solveCode{ MergeFMIP.solve(Clock::timeRemaining(CLIArgs.timeLimit), DET_TL(MergeFMIP.getNumNonZeros())) };
+				Solution		  refSol{ .sol = std::vector<double>(), .slackSum = MTEnv.getBestACSIncumbent().slackSum, .oMIPCost = MTEnv.getBestACSIncumbent().oMIPCost };
+				DetBudget::Budget budget{ MTEnv.getDetBudget().getBudget(DetBudget::Phase::MergeFMIP, MergeFMIP.getNumNonZeros(), Clock::timeRemaining(CLIArgs.timeLimit)) };
+				setupTime = Clock::timeElapsed(setupTime);
+
+				// The OMIP phase always follows: its subMIPs are built while MergeFMIP solves
+				MTEnv.prepareNextPhase(CLIArgs, DetBudget::Phase::OMIP);
+				double solveTime{ Clock::getTime() };
+
+				int solveCode{ MergeFMIP.solve(Clock::timeRemaining(CLIArgs.timeLimit), budget.detTL) };
+				solveTime = Clock::timeElapsed(solveTime);
+				MTEnv.addPhaseTimes(DetBudget::Phase::MergeFMIP, setupTime, solveTime);
 
 				if (MIP::isINForUNBD(solveCode)) {
+					if (!MergeFMIP.hasCutoff()) {
+						MTEnv.getDetBudget().record(DetBudget::Phase::MergeFMIP, 0, budget, MergeFMIP.getLastDetTime(), solveTime, solveCode, 0.0);
 #if ACS_VERBOSE >= VERBOSE
-					PRINT_INFO("MergeFMIP - Aborted: Infeasible with given TL");
+						PRINT_INFO("MergeFMIP - Aborted: Infeasible with given TL");
 #endif
-					continue;
+						continue;
+					}
+					// No merged solution beats the incumbent: go on from it
+					tmpSol = MTEnv.getBestACSIncumbent();
+					solveCode = MIP::cutoffSolveCode(solveCode);
+#if ACS_VERBOSE >= VERBOSE
+					PRINT_INFO("MergeFMIP - No improvement on the incumbent (cutoff)");
+#endif
+				} else {
+					tmpSol.sol = MergeFMIP.getSol();
+					tmpSol.slackSum = MergeFMIP.getObjValue();
+					tmpSol.oMIPCost = MergeFMIP.getOMIPCost(tmpSol.sol);
+					PRINT_OUT("FeasMIP Objective after merging: %20.2f", tmpSol.slackSum);
+					MTEnv.setBestACSIncumbent(tmpSol);
+					MTEnv.getElitePool().insert(tmpSol);
 				}
+				MTEnv.getDetBudget().record(DetBudget::Phase::MergeFMIP, 0, budget, MergeFMIP.getLastDetTime(), solveTime, solveCode, DetBudget::improvement(refSol, tmpSol));
 
-				tmpSol.sol = MergeFMIP.getSol();
-				tmpSol.slackSum = MergeFMIP.getObjValue();
-				tmpSol.oMIPCost = MergeFMIP.getOMIPCost(tmpSol.sol);
-				PRINT_OUT("FeasMIP Objective after merging: %20.2f", tmpSol.slackSum);
-				MTEnv.setBestACSIncumbent(tmpSol);
-
-				FixPolicy::dynamicAdjustRho("1_Phase", solveCode, CLIArgs.numsubMIPs, CLIArgs.rho, MTEnv.getRhoChanges());
 				MTEnv.broadcastSol(tmpSol);
 			}
 
@@ -98,13 +232,23 @@ int main(int argc, char* argv[]) {
 			}
 
 			// PARALLEL OMIP Phase
+			const bool	 improving{ MTEnv.isFeasibleSolFound() };
+			const double phaseCost{ MTEnv.getBestACSIncumbent().oMIPCost };
+			if (coordinator)
+				coordinator->dispatch(DetBudget::Phase::OMIP, tmpSol, MTEnv.getBestACSIncumbent(), CLIArgs.rho, MTEnv.getPolicyPortfolio(), mainRnd, remoteTimeLimit(DetBudget::Phase::OMIP));
 			MTEnv.parallelOMIPOptimization(CLIArgs, tmpSol.slackSum);
+			std::span<const Solution> remoteSols{ collectRemote() };
 
 			// 2° Recombination phase
-			OMIP MergeOMIP(CLIArgs.fileName);
-			MergeOMIP.setNumCores(CPLEX_CORE);
-
-			MergePolicy::recombine(MergeOMIP, MTEnv.getTmpSolutions(), "2_Phase");
+			double setupTime{ Clock::getTime() };
+			OMIP   MergeOMIP(CLIArgs.fileName);
+			MergeOMIP.setNumCores(MTEnv.getNumCores());
+			if (MTEnv.isDeterministic())
+				MergeOMIP.setDeterministic();
+			MTEnv.setOMIPObjLimits(MergeOMIP);
+
+			MergePolicy::recombine(MergeOMIP, MTEnv.getMergeSolutions(), "2_Phase", remoteSols);
+			numStitched += MergePolicy::stitchBlocks(MergeOMIP, MTEnv.getBestACSIncumbent().sol, MTEnv.getTmpSolutions(), MTEnv.getWorkerBlocks(), "2_Phase");
 			// MergeOMIP.updateBudgetConstr(tmpSol.slackSum);			v1.2.11 -- no need of this
 
 			if (MTEnv.getBestACSIncumbent().slackSum < CPX_INFBOUND) {
@@ -119,38 +263,174 @@ int main(int argc, char* argv[]) {
 				break;
 			}
 
-			int solveCode{ MergeOMIP.solve(Clock::timeRemaining(CLIArgs.timeLimit), DET_TL(MergeOMIP.getNumNonZeros())) };
+			Solution		  refSol{ .sol = std::vector<double>(), .slackSum = MTEnv.getBestACSIncumbent().slackSum, .oMIPCost = MTEnv.getBestACSIncumbent().oMIPCost };
+			DetBudget::Budget budget{ MTEnv.getDetBudget().getBudget(DetBudget::Phase::MergeOMIP, MergeOMIP.getNumNonZeros(), Clock::timeRemaining(CLIArgs.timeLimit)) };
+			setupTime = Clock::timeElapsed(setupTime);
+
+			// ACS stops at the first feasible solution (improvement mode: an OMIP phase follows), otherwise an FMIP phase follows
+			if (!MTEnv.isFeasibleSolFound())
+				MTEnv.prepareNextPhase(CLIArgs, DetBudget::Phase::FMIP);
+			else if (CLIArgs.improve)
+				MTEnv.prepareNextPhase(CLIArgs, DetBudget::Phase::OMIP);
+			double solveTime{ Clock::getTime() };
+
+			int solveCode{ MergeOMIP.solve(Clock::timeRemaining(CLIArgs.timeLimit), budget.detTL) };
+			solveTime = Clock::timeElapsed(solveTime);
+			MTEnv.addPhaseTimes(DetBudget::Phase::MergeOMIP, setupTime, solveTime);
 
 			if (MIP::isINForUNBD(solveCode)) {
+				if (!MergeOMIP.hasCutoff()) {
+					MTEnv.getDetBudget().record(DetBudget::Phase::MergeOMIP, 0, budget, MergeOMIP.getLastDetTime(), solveTime, solveCode, 0.0);
 #if ACS_VERBOSE >= VERBOSE
-				PRINT_INFO("MergeOMIP - Aborted: Infeasible with given TL");
+					PRINT_INFO("MergeOMIP - Aborted: Infeasible with given TL");
 #endif
-				continue;
-			}
-
-			tmpSol.sol = MergeOMIP.getSol();
-			tmpSol.slackSum = MergeOMIP.getSlackSum();
-			tmpSol.oMIPCost = MergeOMIP.getObjValue();
+					continue;
+				}
+				// No merged solution beats the incumbent: go on from it
+				tmpSol = MTEnv.getBestACSIncumbent();
+				solveCode = MIP::cutoffSolveCode(solveCode);
+#if ACS_VERBOSE >= VERBOSE
+				PRINT_INFO("MergeOMIP - No improvement on the incumbent (cutoff)");
+#endif
+			} else {
+				tmpSol.sol = MergeOMIP.getSol();
+				tmpSol.slackSum = MergeOMIP.getSlackSum();
+				tmpSol.oMIPCost = MergeOMIP.getObjValue();
 
-			PRINT_OUT("OptMIP Objective|SlackSum after merging: %12.2f|%-10.2f", MergeOMIP.getObjValue(), tmpSol.slackSum);
-			MTEnv.setBestACSIncumbent(tmpSol);
-			FixPolicy::dynamicAdjustRho("2_Phase", solveCode, CLIArgs.numsubMIPs, CLIArgs.rho, MTEnv.getRhoChanges());
+				PRINT_OUT("OptMIP Objective|SlackSum after merging: %12.2f|%-10.2f", MergeOMIP.getObjValue(), tmpSol.slackSum);
+				MTEnv.setBestACSIncumbent(tmpSol);
+				MTEnv.getElitePool().insert(tmpSol);
+			}
+			MTEnv.getDetBudget().record(DetBudget::Phase::MergeOMIP, 0, budget, MergeOMIP.getLastDetTime(), solveTime, solveCode, DetBudget::improvement(refSol, tmpSol));
 
-			if (MTEnv.isFeasibleSolFound())
-				break;
+			if (MTEnv.isFeasibleSolFound()) {
+				if (!CLIArgs.improve)
+					break;
+				if (improving) {
+					numImprovePhases++;
+					numStallPhases = (MTEnv.getBestACSIncumbent().oMIPCost < phaseCost - EPSILON) ? 0 : numStallPhases + 1;
+				}
+				if (numStallPhases >= CLIArgs.improve) {
+#if ACS_VERBOSE >= VERBOSE
+					PRINT_INFO("IMPROVEMENT STALLED");
+#endif
+					break;
+				}
+			}
 			MTEnv.broadcastSol(tmpSol);
 		}
 
 		Solution incumbent = MTEnv.getBestACSIncumbent();
 		double	 retTime = Clock::timeElapsed();
+		const auto& primal{ MTEnv.getPrimalTrajectory() };
+		// Primal integral over the time used, against the one of a run stopped at the first feasible solution
+		double primalIntegral{ MTEnv.getPrimalIntegral(retTime) };
+		double firstPrimalIntegral{ MTEnv.getPrimalIntegral(retTime, 1) };
+		if (!primal.empty())
+			PRINT_OUT("Primal integral: %.4f -- At first feasible: %.4f [improvement: %.4f] -- First feasible: %.2f at %.2fs -- Improvement phases: %zu", primalIntegral, firstPrimalIntegral,
+					  firstPrimalIntegral - primalIntegral, primal.front().cost, primal.front().time, numImprovePhases);
+		PRINT_OUT("SubMIPs solved: %zu [%.2f/s] -- No improvement (cutoff): %zu", MTEnv.getNumSubMIPs(), MTEnv.getNumSubMIPs() / retTime, MTEnv.getNumCutoffSubMIPs());
+		for (size_t p{ 0 }; p < static_cast<size_t>(DetBudget::Phase::_count); p++) {
+			DetBudget::Phase			 phase{ static_cast<DetBudget::Phase>(p) };
+			const MTContext::PhaseTimes& times{ MTEnv.getPhaseTimes(phase) };
+			PRINT_OUT("%-9s -- Setup: %9.2fs -- Hidden: %9.2fs -- Refresh: %9.2fs -- Solve: %9.2fs [Prepared: %zu - Refreshed: %zu - Discarded: %zu]",
+					  DetBudget::phaseName(phase), times.setup, times.hidden, times.refresh, times.solve, times.prepared, times.refreshed, times.discarded);
+		}
+		for (DetBudget::Phase phase : { DetBudget::Phase::FMIP, DetBudget::Phase::OMIP }) {
+			const ElasticWorkers::PhaseStats& elastic{ MTEnv.getElasticWorkers().getStats(phase) };
+			if (elastic.rounds)
+				PRINT_OUT("%-9s -- Rounds: %zu -- Active subMIPs: avg %5.2f [min %zu - max %zu]", DetBudget::phaseName(phase), elastic.rounds, static_cast<double>(elastic.sumActive) / elastic.rounds, elastic.minActive, elastic.maxActive);
+		}
+		if (coordinator)
+			coordinator->printStats();
+		const ElitePool::Stats& elite{ MTEnv.getElitePool().getStats() };
+		if (MTEnv.getElitePool().isEnabled())
+			PRINT_OUT("Elite pool -- Size: %zu -- Offered: %zu -- Duplicates: %zu [%.2f%%] -- Inserted: %zu -- Evicted: %zu -- Rejected: %zu", MTEnv.getElitePool().getSize(), elite.offered, elite.duplicates,
+					  elite.offered ? 100.0 * elite.duplicates / elite.offered : 0.0, elite.inserted, elite.evicted, elite.rejected);
+		if (!blocks.vars.empty())
+			PRINT_OUT("Blocks -- Count: %zu -- Blocks stitched into merge MIP starts: %zu", blocks.vars.size(), numStitched);
+		if (const Propagator* propagator{ MTEnv.getPropagator() })
+			PRINT_OUT("Propagator -- Runs: %zu -- Infeasible fixings (solves avoided): %zu -- Bounds tightened: %zu", propagator->getNumRuns(), propagator->getNumInfeasible(), propagator->getNumTightened());
+		const NeighborhoodCache::Stats& nbh{ MTEnv.getNeighborhoodCache().getStats() };
+		size_t							nbhHits{ std::accumulate(nbh.hits.begin(), nbh.hits.end(), size_t{ 0 }) };
+		if (MTEnv.getNeighborhoodCache().isEnabled())
+			PRINT_OUT("Nbh cache -- Lookups: %zu -- Hits: %zu [%.2f%%] (Infeasible: %zu - Optimal: %zu - Limit: %zu) -- Redrawn: %zu -- Skipped: %zu", nbh.lookups, nbhHits, nbh.lookups ? 100.0 * nbhHits / nbh.lookups : 0.0,
+					  nbh.hits[static_cast<size_t>(NeighborhoodCache::Outcome::Infeasible)], nbh.hits[static_cast<size_t>(NeighborhoodCache::Outcome::Optimal)], nbh.hits[static_cast<size_t>(NeighborhoodCache::Outcome::Limit)], nbh.perturbed, nbh.skipped);
+		const auto& rhoWorkers{ MTEnv.getRhoController().getStats() };
+		for (size_t i{ 0 }; i < rhoWorkers.size(); i++) {
+			if (rhoWorkers[i].solves)
+				PRINT_OUT("Proc: %3zu -- Rho: %5.4f -- Step: %5.4f -- Solves: %5zu -- Optimal: %5zu -- No impr.: %5zu -- Limit: %5zu", i, rhoWorkers[i].rho.load(), rhoWorkers[i].step, rhoWorkers[i].solves, rhoWorkers[i].complete, rhoWorkers[i].noImprove, rhoWorkers[i].limits);
+		}
+		for (DetBudget::Phase phase : { DetBudget::Phase::FMIP, DetBudget::Phase::OMIP }) {
+			const auto& policies{ MTEnv.getPolicyPortfolio().getStats(phase) };
+			for (size_t p{ 0 }; p < policies.size(); p++) {
+				if (!policies[p].picks)
+					continue;
+				PRINT_OUT("%-9s -- Policy: %-11s -- Picks: %5zu -- Solves: %5zu -- No sol: %5zu -- Improvement: %8.4f -- Reward: %10.6f -- Impr/Ktick: %10.6f", DetBudget::phaseName(phase), PolicyPortfolio::policyName(static_cast<PolicyPortfolio::Policy>(p)), policies[p].picks, policies[p].solves, policies[p].infeasible, policies[p].improvement,
+						  (policies[p].cost > EPSILON) ? policies[p].improvement / policies[p].cost : 0.0, (policies[p].ticks > EPSILON) ? 1e3 * policies[p].improvement / policies[p].ticks : 0.0);
+			}
+		}
 #if ACS_TEST
 		nlohmann::json jsData;
+		nlohmann::json jsStats;
+
+		for (size_t f{ 0 }; f < AutoConfig::numFeatures(); f++)
+			jsStats["features"][AutoConfig::featureName(f)] = AutoConfig::featureValue(features, f);
+		if (autoConfig) {
+			jsStats["autoConfig"] = { { "rho", config.rho }, { "numsubMIPs", config.numsubMIPs }, { "fixPolicy", PolicyPortfolio::policyName(static_cast<PolicyPortfolio::Policy>(config.fixPolicy)) }, { "detScale", config.detScale }, { "rules", nlohmann::json::array() } };
+			for (size_t r : config.matched)
+				jsStats["autoConfig"]["rules"].push_back(autoConfig->getRule(r));
+		}
+		jsStats["primal"] = { { "integral", primalIntegral }, { "firstFeasibleIntegral", firstPrimalIntegral }, { "improvePhases", numImprovePhases }, { "trajectory", nlohmann::json::array() } };
+		for (const auto& sample : primal)
+			jsStats["primal"]["trajectory"].push_back({ sample.time, sample.cost });
+		jsStats["subMIPs"] = { { "solved", MTEnv.getNumSubMIPs() }, { "cutoff", MTEnv.getNumCutoffSubMIPs() } };
+		if (const Propagator* propagator{ MTEnv.getPropagator() })
+			jsStats["propagator"] = { { "runs", propagator->getNumRuns() }, { "infeasible", propagator->getNumInfeasible() }, { "tightened", propagator->getNumTightened() } };
+		jsStats["blocks"] = { { "blocks", blocks.vars.size() }, { "components", blocks.numComps }, { "linkingRows", blocks.numLinks }, { "stitched", numStitched } };
+		jsStats["nbhCache"] = { { "lookups", nbh.lookups }, { "perturbed", nbh.perturbed }, { "skipped", nbh.skipped }, { "records", nbh.records } };
+		for (size_t o{ 0 }; o < nbh.hits.size(); o++)
+			jsStats["nbhCache"]["hits"][NeighborhoodCache::outcomeName(static_cast<NeighborhoodCache::Outcome>(o))] = nbh.hits[o];
+		jsStats["rho"] = nlohmann::json::array();
+		for (const auto& worker : rhoWorkers) {
+			nlohmann::json jsWorker{ { "rho", worker.rho.load() }, { "step", worker.step }, { "solves", worker.solves }, { "optimal", worker.complete }, { "noImprovement", worker.noImprove }, { "limit", worker.limits } };
+			jsWorker["trajectory"] = nlohmann::json::array();
+			for (const auto& sample : worker.trajectory)
+				jsWorker["trajectory"].push_back({ sample.time, sample.rho, sample.move });
+			jsStats["rho"].push_back(jsWorker);
+		}
+		jsStats["elitePool"] = { { "size", MTEnv.getElitePool().getSize() }, { "offered", elite.offered }, { "duplicates", elite.duplicates }, { "inserted", elite.inserted }, { "evicted", elite.evicted }, { "rejected", elite.rejected } };
+		for (size_t p{ 0 }; p < static_cast<size_t>(DetBudget::Phase::_count); p++) {
+			DetBudget::Phase phase{ static_cast<DetBudget::Phase>(p) };
+			nlohmann::json	 jsPhase;
+
+			jsPhase["tickRate"] = MTEnv.getDetBudget().getTickRate(phase);
+			jsPhase["arms"] = nlohmann::json::array();
+			for (const auto& arm : MTEnv.getDetBudget().getArmStats(phase))
+				jsPhase["arms"].push_back({ { "scale", arm.scale }, { "picks", arm.picks }, { "solves", arm.solves }, { "ticks", arm.ticks }, { "improvement", arm.improvement } });
+			jsPhase["workers"] = nlohmann::json::array();
+			for (const auto& worker : MTEnv.getDetBudget().getWorkerStats(phase))
+				jsPhase["workers"].push_back({ { "solves", worker.solves }, { "ticks", worker.ticks }, { "improvement", worker.improvement }, { "optimal", worker.optimal }, { "limit", worker.limit }, { "infeasible", worker.infeasible } });
+
+			jsStats["detBudget"][DetBudget::phaseName(phase)] = jsPhase;
+
+			const MTContext::PhaseTimes& times{ MTEnv.getPhaseTimes(phase) };
+			if (phase == DetBudget::Phase::FMIP || phase == DetBudget::Phase::OMIP) {
+				const ElasticWorkers::PhaseStats& elastic{ MTEnv.getElasticWorkers().getStats(phase) };
+				jsStats["elastic"][DetBudget::phaseName(phase)] = { { "rounds", elastic.rounds }, { "sumActive", elastic.sumActive }, { "minActive", elastic.minActive }, { "maxActive", elastic.maxActive } };
+
+				const auto& policies{ MTEnv.getPolicyPortfolio().getStats(phase) };
+				for (size_t p{ 0 }; p < policies.size(); p++)
+					jsStats["portfolio"][DetBudget::phaseName(phase)][PolicyPortfolio::policyName(static_cast<PolicyPortfolio::Policy>(p))] = { { "picks", policies[p].picks }, { "solves", policies[p].solves }, { "improvement", policies[p].improvement }, { "cost", policies[p].cost }, { "ticks", policies[p].ticks }, { "infeasible", policies[p].infeasible } };
+			}
+			jsStats["phaseTimes"][DetBudget::phaseName(phase)] = { { "setup", times.setup }, { "hidden", times.hidden }, { "refresh", times.refresh }, { "solve", times.solve }, { "prepared", times.prepared }, { "refreshed", times.refreshed }, { "discarded", times.discarded } };
+		}
 #endif
 		printf("--------------------------------------------------------------------------------\n");
 		if (incumbent.sol.empty() || incumbent.slackSum > EPSILON) {
 			PRINT_ERR("No solution found within time-limit: %-10.4f", CLIArgs.timeLimit);
 #if ACS_TEST
-			jsData[CLIArgs.fileName][std::to_string(CLIArgs.algo)][std::to_string(CLIArgs.seed)] = { "NO SOL", retTime };
+			jsData[CLIArgs.fileName][std::to_string(CLIArgs.algo)][std::to_string(CLIArgs.seed)] = { "NO SOL", retTime, jsStats };
 #endif
 		} else {
 			MIP og(CLIArgs.fileName);
@@ -183,9 +463,16 @@ int main(int argc, char* argv[]) {
 			heuFound = true;
 			PRINT_BEST("ACS Solution: %16.4f \n\t\t   Time elapsed: %-10.4f", incumbent.oMIPCost, retTime);
 #if ACS_TEST
-			jsData[CLIArgs.fileName][std::to_string(CLIArgs.algo)][std::to_string(CLIArgs.seed)] = { incumbent.oMIPCost, retTime };
+			jsData[CLIArgs.fileName][std::to_string(CLIArgs.algo)][std::to_string(CLIArgs.seed)] = { incumbent.oMIPCost, retTime, jsStats };
 #endif
 		}
+		// Outcome of the run for external drivers (see Tuner.cpp)
+		if (!CLIArgs.resultFile.empty()) {
+			nlohmann::json jsResult{ { "instance", CLIArgs.fileName }, { "seed", CLIArgs.seed }, { "feasible", heuFound }, { "cost", heuFound ? nlohmann::json(incumbent.oMIPCost) : nlohmann::json() },
+									 { "slackSum", incumbent.sol.empty() ? nlohmann::json() : nlohmann::json(incumbent.slackSum) }, { "time", retTime }, { "primalIntegral", primalIntegral } };
+			std::ofstream	resFile(CLIArgs.resultFile);
+			resFile << jsResult.dump();
+		}
 #if ACS_TEST
 		std::string	  JSfilename = CLIArgs.fileName + "_ACS_" + std::to_string(CLIArgs.algo) + "_" + std::to_string(CLIArgs.seed) + ".json";
 		std::ofstream oFile(PATH_TO_TMP + JSfilename);
@@ -0,0 +1,143 @@
+#include "../include/AutoConfig.hpp"
+#include "../include/FixPolicy.hpp"
+#include "../include/PolicyPortfolio.hpp"
+
+using ACSEx = ACSException::ExceptionType;
+
+AutoConfig::AutoConfig(const std::string& rulesFile) {
+	if (rulesFile.empty()) {
+		for (const char* rule : AUTO_CONFIG_RULES)
+			addRule(rule);
+		return;
+	}
+
+	std::ifstream file(rulesFile);
+	if (!file)
+		throw AutoConfigException(ACSEx::FileNotFound, "Unable to read the rules file " + rulesFile);
+
+	std::string line;
+	while (std::getline(file, line)) {
+		size_t first{ line.find_first_not_of(" \t\r") };
+		if (first == std::string::npos || line[first] == '#')
+			continue;
+		addRule(line.substr(first, line.find_last_not_of(" \t\r") - first + 1));
+	}
+}
+
+AutoConfig::Config AutoConfig::select(const InstanceFeatures& features, const Args& CLIArgs) const {
+	Config config{ .rho = CLIArgs.rho, .numsubMIPs = CLIArgs.numsubMIPs, .fixPolicy = CLIArgs.fixPolicy, .detScale = CLIArgs.detScale, .matched = {} };
+
+	for (size_t r{ 0 }; r < rules.size(); r++) {
+		bool match{ true };
+		for (const Condition& cond : rules[r].conditions) {
+			double value{ featureValue(features, cond.feature) };
+			if (cond.op == "<")
+				match = value < cond.value;
+			else if (cond.op == "<=")
+				match = value <= cond.value;
+			else if (cond.op == ">")
+				match = value > cond.value;
+			else if (cond.op == ">=")
+				match = value >= cond.value;
+			else
+				match = std::abs(value - cond.value) < EPSILON;
+			if (!match)
+				break;
+		}
+		if (!match)
+			continue;
+
+		config.matched.push_back(r);
+		for (const auto& [param, value] : rules[r].assignments) {
+			switch (param) {
+				case Param::Rho:
+					config.rho = value;
+					break;
+				case Param::NumSubMIPs:
+					config.numsubMIPs = static_cast<size_t>(value);
+					break;
+				case Param::FixPolicy:
+					config.fixPolicy = static_cast<size_t>(value);
+					break;
+				case Param::DetScale:
+					config.detScale = value;
+					break;
+				default:
+					break;
+			}
+		}
+	}
+
+#if ACS_VERBOSE >= VERBOSE
+	PRINT_INFO("AutoConfig::select - %zu/%zu rules matched -- Rho: %5.4f -- SubMIPs: %zu -- Fixing policy: %zu -- DET_TL scale: %4.2f", config.matched.size(), rules.size(), config.rho, config.numsubMIPs, config.fixPolicy, config.detScale);
+#endif
+	return config;
+}
+
+double AutoConfig::featureValue(const InstanceFeatures& features, size_t index) {
+	if (index >= featureTable.size())
+		throw AutoConfigException(ACSEx::OutOfBound, "Feature index out of range");
+	return featureTable[index].value(features);
+}
+
+void AutoConfig::addRule(const std::string& text) {
+	size_t colon{ text.find(':') };
+	if (colon == std::string::npos)
+		throw AutoConfigException(ACSEx::WrongArgsValue, "Missing ':' in rule \"" + text + "\"");
+
+	Rule rule{ .conditions = {}, .assignments = {}, .text = text };
+
+	// Conditions: <feature> <op> <value> [&& <feature> <op> <value> ...]
+	std::istringstream conds(text.substr(0, colon));
+	std::string		   name, op, value;
+	while (conds >> name) {
+		if (name == "&&")
+			continue;
+		if (!(conds >> op >> value))
+			throw AutoConfigException(ACSEx::WrongArgsValue, "Incomplete condition in rule \"" + text + "\"");
+
+		auto feature{ std::find_if(featureTable.begin(), featureTable.end(), [&](const Feature& f) { return name == f.name; }) };
+		if (feature == featureTable.end())
+			throw AutoConfigException(ACSEx::WrongArgsValue, "Unknown feature \"" + name + "\" in rule \"" + text + "\"");
+		if (op != "<" && op != "<=" && op != ">" && op != ">=" && op != "==")
+			throw AutoConfigException(ACSEx::WrongArgsValue, "Unknown operator \"" + op + "\" in rule \"" + text + "\"");
+
+		rule.conditions.push_back({ .feature = static_cast<size_t>(feature - featureTable.begin()), .op = op, .value = std::strtod(value.c_str(), nullptr) });
+	}
+
+	// Assignments: <param>=<value> ...
+	std::istringstream assigns(text.substr(colon + 1));
+	std::string		   assign;
+	while (assigns >> assign) {
+		size_t eq{ assign.find('=') };
+		auto   param{ std::find_if(paramNames.begin(), paramNames.end(), [&](const char* p) { return assign.substr(0, eq) == p; }) };
+		if (eq == std::string::npos || param == paramNames.end())
+			throw AutoConfigException(ACSEx::WrongArgsValue, "Unknown assignment \"" + assign + "\" in rule \"" + text + "\"");
+
+		Param  p{ static_cast<Param>(param - paramNames.begin()) };
+		double v{ std::strtod(assign.c_str() + eq + 1, nullptr) };
+		bool   valid{ true };
+		switch (p) {
+			case Param::Rho:
+				valid = v >= MIN_RHO && v <= MAX_RHO;
+				break;
+			case Param::NumSubMIPs:
+				valid = v >= 1 && v <= AUTO_CONFIG_MAX_SUBMIPS;
+				break;
+			case Param::FixPolicy:
+				valid = v >= 0 && v < static_cast<size_t>(PolicyPortfolio::Policy::_count) && v == std::floor(v);
+				break;
+			case Param::DetScale:
+				valid = v > EPSILON && v <= AUTO_CONFIG_MAX_DET_SCALE;
+				break;
+			default:
+				break;
+		}
+		if (!valid)
+			throw AutoConfigException(ACSEx::WrongArgsValue, "Value out of range in rule \"" + text + "\"");
+
+		rule.assignments.push_back({ p, v });
+	}
+
+	rules.push_back(std::move(rule));
+}
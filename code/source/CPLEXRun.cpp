@@ -15,7 +15,6 @@
 #define PATH_TO_TMP "../test/scripts/tmp/"
 
 #define CPLEX_RUN true
-#define NUM_CORE 4
 
 int main(int argc, char* argv[]) {
 	try {
@@ -24,7 +23,7 @@ int main(int argc, char* argv[]) {
 		Args CLIArgs = CLIParser(argc, argv, CPLEX_RUN).getArgs();
 
 		MIP ogMIP{ CLIArgs.fileName };
-		ogMIP.setNumCores(NUM_CORE).setNumSols(NUM_SOL_STOP);
+		ogMIP.setNumCores(CLIArgs.numCores).setNumSols(NUM_SOL_STOP);
 		Solution CPLEXSol = { .sol = std::vector<double>(), .slackSum = CPX_INFBOUND, .oMIPCost = CPX_INFBOUND };
 
 		int solveCode{ ogMIP.solve(Clock::timeRemaining(CLIArgs.timeLimit)) };
@@ -0,0 +1,226 @@
+#include "../include/CoreScheduler.hpp"
+
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+/**
+ * @brief Parses a Linux CPU list (e.g. "0-3,8,10-11").
+ *
+ * @param list The CPU list.
+ * @return IDs of the listed CPUs.
+ */
+static std::vector<int> parseCPUList(const std::string& list) {
+	std::vector<int>  cpus;
+	std::stringstream ss(list);
+	std::string		  range;
+
+	while (std::getline(ss, range, ',')) {
+		if (range.empty() || !std::isdigit(static_cast<unsigned char>(range[0])))
+			continue;
+		size_t dash{ range.find('-') };
+		int	   first{ std::stoi(range.substr(0, dash)) };
+		int	   last{ (dash == std::string::npos) ? first : std::stoi(range.substr(dash + 1)) };
+		for (int cpu{ first }; cpu <= last; cpu++)
+			cpus.push_back(cpu);
+	}
+	return cpus;
+}
+
+CoreScheduler::CoreScheduler(size_t numCores, size_t numWorkers, bool pin) : numCores{ std::max<size_t>(1, numCores) }, pinned{ pin }, running(numWorkers, false), numActive{ 0 }, numPhase{ 0 } {
+	if (!pinned)
+		return;
+
+	readTopology();
+	layoutWorkers();
+	printTopology();
+}
+
+void CoreScheduler::startPhase(size_t numWorkers) {
+	std::lock_guard<std::mutex> lock(schedMTX);
+
+	if (numWorkers > running.size()) {
+		running.resize(numWorkers, false);
+		if (pinned)
+			layoutWorkers();
+	}
+
+	for (size_t i{ 0 }; i < running.size(); i++)
+		running[i] = (i < numWorkers);
+	numActive = numWorkers;
+	numPhase = numWorkers;
+}
+
+void CoreScheduler::release(size_t thID) {
+	std::lock_guard<std::mutex> lock(schedMTX);
+
+	if (thID < running.size() && running[thID]) {
+		running[thID] = false;
+		numActive--;
+	}
+}
+
+size_t CoreScheduler::getShare(size_t thID) {
+	std::lock_guard<std::mutex> lock(schedMTX);
+
+	if (!numActive || thID >= running.size() || !running[thID])
+		return 1;
+
+	size_t rank{ static_cast<size_t>(std::count(running.begin(), running.begin() + thID, true)) };
+	size_t share{ numCores / numActive + ((rank < numCores % numActive) ? 1 : 0) };
+	return std::max<size_t>(1, share);
+}
+
+size_t CoreScheduler::getPhaseShare(size_t thID) {
+	std::lock_guard<std::mutex> lock(schedMTX);
+
+	if (!numPhase || thID >= numPhase)
+		return 1;
+	return std::max<size_t>(1, numCores / numPhase + ((thID < numCores % numPhase) ? 1 : 0));
+}
+
+bool CoreScheduler::pinWorker(size_t thID) {
+	std::vector<int> cpus;
+	{
+		std::lock_guard<std::mutex> lock(schedMTX);
+		if (!pinned || thID >= homeCPUs.size())
+			return false;
+		cpus = homeCPUs[thID];
+	}
+
+#ifdef __linux__
+	cpu_set_t cpuSet;
+	CPU_ZERO(&cpuSet);
+	for (int cpu : cpus)
+		CPU_SET(cpu, &cpuSet);
+
+	if (pthread_setaffinity_np(pthread_self(), sizeof(cpu_set_t), &cpuSet)) {
+		PRINT_WARN("Proc: %3d - CoreScheduler - Pinning failed", thID);
+		return false;
+	}
+	return true;
+#else
+	return false;
+#endif
+}
+
+std::vector<int> CoreScheduler::getCPUSet(size_t thID, size_t share) {
+	std::lock_guard<std::mutex> lock(schedMTX);
+
+	if (!pinned || thID >= homeCPUs.size())
+		return {};
+
+	std::vector<int> cpus{ homeCPUs[thID] };
+	auto			 addFreeCPUs = [&](bool sameNode) {
+		for (size_t w{ 0 }; w < homeCPUs.size() && cpus.size() < share; w++) {
+			if (w == thID || (w < running.size() && running[w]) || (homeNode[w] == homeNode[thID]) != sameNode)
+				continue;
+			for (int cpu : homeCPUs[w])
+				if (cpus.size() < share && std::find(cpus.begin(), cpus.end(), cpu) == cpus.end())
+					cpus.push_back(cpu);
+		}
+	};
+
+	// Cores freed on the local node first, then on the remote ones
+	addFreeCPUs(true);
+	addFreeCPUs(false);
+	return cpus;
+}
+
+void CoreScheduler::readTopology() {
+	std::vector<int> allowed;
+#ifdef __linux__
+	cpu_set_t procSet;
+	CPU_ZERO(&procSet);
+	if (!sched_getaffinity(0, sizeof(cpu_set_t), &procSet))
+		for (int cpu{ 0 }; cpu < CPU_SETSIZE; cpu++)
+			if (CPU_ISSET(cpu, &procSet))
+				allowed.push_back(cpu);
+#endif
+	if (allowed.empty()) {
+		allowed.resize(std::max(1u, std::thread::hardware_concurrency()));
+		std::iota(allowed.begin(), allowed.end(), 0);
+	}
+
+	std::vector<std::vector<int>> nodes;
+	std::ifstream				  possible(CORE_SCHED_NODE_DIR "possible");
+	std::string					  line;
+	if (possible && std::getline(possible, line)) {
+		for (int node : parseCPUList(line)) {
+			std::ifstream cpuList(CORE_SCHED_NODE_DIR "node" + std::to_string(node) + "/cpulist");
+			if (!cpuList || !std::getline(cpuList, line))
+				continue;
+
+			std::vector<int> cpus;
+			for (int cpu : parseCPUList(line))
+				if (std::find(allowed.begin(), allowed.end(), cpu) != allowed.end())
+					cpus.push_back(cpu);
+			if (!cpus.empty())
+				nodes.push_back(std::move(cpus));
+		}
+	}
+	// No NUMA information: one node with all the allowed CPUs
+	if (nodes.empty())
+		nodes.push_back(allowed);
+
+	// Keep numCores CPUs, taken round-robin across the nodes
+	nodeCPUs = std::vector<std::vector<int>>(nodes.size());
+	size_t taken{ 0 };
+	for (size_t k{ 0 }; taken < numCores; k++) {
+		bool any{ false };
+		for (size_t n{ 0 }; n < nodes.size() && taken < numCores; n++) {
+			if (k < nodes[n].size()) {
+				nodeCPUs[n].push_back(nodes[n][k]);
+				taken++;
+				any = true;
+			}
+		}
+		if (!any)
+			break;
+	}
+
+	// Nodes left without CPUs (small budget) do not host workers
+	std::erase_if(nodeCPUs, [](const std::vector<int>& cpus) { return cpus.empty(); });
+}
+
+void CoreScheduler::layoutWorkers() {
+	size_t numNodes{ nodeCPUs.size() };
+	size_t numWorkers{ running.size() };
+
+	homeCPUs = std::vector<std::vector<int>>(numWorkers);
+	homeNode = std::vector<size_t>(numWorkers, 0);
+
+	for (size_t w{ 0 }; w < numWorkers; w++) {
+		size_t node{ w % numNodes };
+		size_t rank{ w / numNodes };
+		size_t nodeWorkers{ numWorkers / numNodes + ((node < numWorkers % numNodes) ? 1 : 0) };
+
+		const std::vector<int>& cpus{ nodeCPUs[node] };
+		size_t					first{ rank * cpus.size() / nodeWorkers };
+		size_t					last{ std::max(first + 1, (rank + 1) * cpus.size() / nodeWorkers) };
+
+		homeNode[w] = node;
+		for (size_t c{ first }; c < last; c++)
+			homeCPUs[w].push_back(cpus[c % cpus.size()]);
+	}
+}
+
+void CoreScheduler::printTopology() const {
+	PRINT_OUT("CoreScheduler: Pinned placement -- NUMA nodes: %zu -- Core budget: %zu -- Workers: %zu", nodeCPUs.size(), numCores, homeCPUs.size());
+
+	auto toString = [](const std::vector<int>& cpus) {
+		std::string str;
+		for (size_t i{ 0 }; i < cpus.size(); i++)
+			str += (i ? "," : "") + std::to_string(cpus[i]);
+		return str;
+	};
+
+	for (size_t n{ 0 }; n < nodeCPUs.size(); n++)
+		PRINT_OUT("CoreScheduler: Node %zu -- CPUs: %s", n, toString(nodeCPUs[n]).c_str());
+
+#if ACS_VERBOSE >= VERBOSE
+	for (size_t w{ 0 }; w < homeCPUs.size(); w++)
+		PRINT_INFO("CoreScheduler: Worker %3zu -- Node %zu -- CPUs: %s", w, homeNode[w], toString(homeCPUs[w]).c_str());
+#endif
+}
@@ -0,0 +1,117 @@
+#include "../include/DetBudget.hpp"
+
+DetBudget::DetBudget(size_t numWorkers, bool deterministic) : deterministic{ deterministic } {
+	const std::vector<double> scales = DET_BUDGET_ARMS;
+
+	for (size_t p{ 0 }; p < NUM_PHASES; p++) {
+		armStats[p].reserve(scales.size());
+		for (double scale : scales)
+			armStats[p].push_back({ .scale = scale, .picks = 0, .solves = 0, .ticks = 0.0, .improvement = 0.0 });
+
+		workerStats[p] = std::vector<WorkerStats>(numWorkers, { .solves = 0, .ticks = 0.0, .improvement = 0.0, .optimal = 0, .limit = 0, .infeasible = 0 });
+		tickRate[p] = 0.0;
+	}
+}
+
+DetBudget::Budget DetBudget::getBudget(Phase phase, size_t nnz, double timeRemaining) {
+	std::lock_guard<std::mutex> lock(budgetMTX);
+
+	size_t arm{ pickArm(phase) };
+	armStats[static_cast<size_t>(phase)][arm].picks++;
+
+	return armBudget(phase, arm, nnz, timeRemaining);
+}
+
+size_t DetBudget::reserveArm(Phase phase) {
+	std::lock_guard<std::mutex> lock(budgetMTX);
+
+	size_t arm{ pickArm(phase) };
+	armStats[static_cast<size_t>(phase)][arm].picks++;
+	return arm;
+}
+
+DetBudget::Budget DetBudget::getBudget(Phase phase, size_t arm, size_t nnz, double timeRemaining) {
+	std::lock_guard<std::mutex> lock(budgetMTX);
+	return armBudget(phase, arm, nnz, timeRemaining);
+}
+
+DetBudget::Budget DetBudget::armBudget(Phase phase, size_t arm, size_t nnz, double timeRemaining) {
+	double detTL{ std::clamp(baseScale * armStats[static_cast<size_t>(phase)][arm].scale * DET_TL(nnz), MIN_DET_TL, MAX_DET_TL) };
+
+	// Do not hand out more ticks than the wall time left can afford
+	double rate{ tickRate[static_cast<size_t>(phase)] };
+	if (!deterministic && rate > EPSILON && timeRemaining < CPX_INFBOUND)
+		detTL = std::max(MIN_DET_TL, std::min(detTL, rate * timeRemaining));
+
+	return { .detTL = detTL, .arm = arm };
+}
+
+void DetBudget::record(Phase phase, size_t thID, const Budget& budget, double ticks, double wallTime, int solveCode, double improvement) {
+	std::lock_guard<std::mutex> lock(budgetMTX);
+	size_t						p{ static_cast<size_t>(phase) };
+
+	ArmStats& arm{ armStats[p][budget.arm] };
+	arm.solves++;
+	arm.ticks += ticks;
+	arm.improvement += improvement;
+
+	if (thID < workerStats[p].size()) {
+		WorkerStats& worker{ workerStats[p][thID] };
+		worker.solves++;
+		worker.ticks += ticks;
+		worker.improvement += improvement;
+
+		switch (solveCode) {
+			case CPXMIP_OPTIMAL:
+			case CPXMIP_OPTIMAL_TOL:
+				worker.optimal++;
+				break;
+
+			case CPXMIP_DETTIME_LIM_FEAS:
+			case CPXMIP_TIME_LIM_FEAS:
+				worker.limit++;
+				break;
+
+			case MIP_NO_IMPROVEMENT:
+				worker.infeasible++;
+				break;
+
+			default:
+				if (MIP::isINForUNBD(solveCode))
+					worker.infeasible++;
+				else
+					worker.limit++;
+				break;
+		}
+	}
+
+	if (wallTime > EPSILON && ticks > EPSILON)
+		tickRate[p] = (tickRate[p] < EPSILON) ? ticks / wallTime : (1 - DET_BUDGET_RATE_ALPHA) * tickRate[p] + DET_BUDGET_RATE_ALPHA * ticks / wallTime;
+}
+
+double DetBudget::improvement(const Solution& ref, const Solution& sol) {
+	auto relImprovement = [](double refVal, double val) {
+		if (val >= CPX_INFBOUND)
+			return 0.0;
+		if (refVal >= CPX_INFBOUND)
+			return 1.0;
+		return std::clamp((refVal - val) / std::max(std::abs(refVal), 1.0), 0.0, 1.0);
+	};
+
+	if (std::abs(ref.slackSum) > EPSILON)
+		return relImprovement(std::abs(ref.slackSum), std::abs(sol.slackSum));
+	if (std::abs(sol.slackSum) > EPSILON)
+		return 0.0;
+	return relImprovement(ref.oMIPCost, sol.oMIPCost);
+}
+
+size_t DetBudget::pickArm(Phase phase) {
+	const std::vector<ArmStats>& arms{ armStats[static_cast<size_t>(phase)] };
+
+	// Arms never tried are given in order (base scale first)
+	std::vector<UCB::Arm> ucbArms;
+	ucbArms.reserve(arms.size());
+	for (const ArmStats& arm : arms)
+		ucbArms.push_back({ .picks = arm.picks, .solves = arm.solves, .gain = arm.improvement, .cost = arm.ticks, .available = true });
+	return UCB::pick(ucbArms, DET_BUDGET_UCB_C);
+}
@@ -0,0 +1,541 @@
+#include "../include/Distributed.hpp"
+#include "../include/FMIP.hpp"
+#include "../include/FixPolicy.hpp"
+#include "../include/OMIP.hpp"
+
+#include <cstring>
+#include <memory>
+
+#include <netdb.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+using namespace DistProtocol;
+using DEx = DistException::ExceptionType;
+
+/**
+ * @brief Sends a whole buffer (retrying partial writes).
+ *
+ * @param fd Socket.
+ * @param data Buffer.
+ * @param size Bytes to send.
+ * @return True on success.
+ */
+static bool sendAll(int fd, const void* data, size_t size) {
+	const char* ptr{ static_cast<const char*>(data) };
+	while (size) {
+		ssize_t sent{ send(fd, ptr, size, MSG_NOSIGNAL) };
+		if (sent <= 0)
+			return false;
+		ptr += sent;
+		size -= static_cast<size_t>(sent);
+	}
+	return true;
+}
+
+/**
+ * @brief Receives exactly size bytes (retrying partial reads).
+ *
+ * @param fd Socket.
+ * @param data Buffer.
+ * @param size Bytes to receive.
+ * @return True on success, false on error or closed connection.
+ */
+static bool recvAll(int fd, void* data, size_t size) {
+	char* ptr{ static_cast<char*>(data) };
+	while (size) {
+		ssize_t got{ recv(fd, ptr, size, 0) };
+		if (got <= 0)
+			return false;
+		ptr += got;
+		size -= static_cast<size_t>(got);
+	}
+	return true;
+}
+
+/**
+ * @brief Sends a message.
+ *
+ * @param fd Socket.
+ * @param type Kind of message.
+ * @param payload Payload of the message.
+ * @param bytes Counter of the bytes sent (updated).
+ * @return True on success.
+ */
+static bool sendMsg(int fd, MsgType type, const std::vector<char>& payload, size_t& bytes) {
+	MsgHeader header{ .type = static_cast<uint32_t>(type), .pad = 0, .size = payload.size() };
+	if (!sendAll(fd, &header, sizeof(header)) || !sendAll(fd, payload.data(), payload.size()))
+		return false;
+	bytes += sizeof(header) + payload.size();
+	return true;
+}
+
+/**
+ * @brief Receives a message.
+ *
+ * @param fd Socket.
+ * @param header Header of the message (output).
+ * @param payload Payload of the message (output).
+ * @param bytes Counter of the bytes received (updated).
+ * @return True on success.
+ * @throws DistException if the payload exceeds DIST_MAX_MSG_SIZE.
+ */
+static bool recvMsg(int fd, MsgHeader& header, std::vector<char>& payload, size_t& bytes) {
+	if (!recvAll(fd, &header, sizeof(header)))
+		return false;
+	if (header.size > DIST_MAX_MSG_SIZE)
+		throw DistException(DEx::Network, "Message of " + std::to_string(header.size) + " bytes exceeds DIST_MAX_MSG_SIZE");
+	payload.resize(header.size);
+	if (!recvAll(fd, payload.data(), payload.size()))
+		return false;
+	bytes += sizeof(header) + payload.size();
+	return true;
+}
+
+/**
+ * @brief Appends the entries of cur that differ from last, then makes last equal to cur.
+ *
+ * @param buffer Payload the Delta entries are appended to.
+ * @param last Copy held by the other side (updated).
+ * @param cur New vector.
+ * @return Number of entries appended.
+ */
+static uint64_t appendDeltas(std::vector<char>& buffer, std::vector<double>& last, const std::vector<double>& cur) {
+	uint64_t count{ 0 };
+	last.resize(cur.size(), 0.0);
+
+	for (size_t i{ 0 }; i < cur.size(); i++) {
+		if (last[i] == cur[i])
+			continue;
+		Delta delta{ .index = i, .value = cur[i] };
+		buffer.insert(buffer.end(), reinterpret_cast<const char*>(&delta), reinterpret_cast<const char*>(&delta) + sizeof(delta));
+		last[i] = cur[i];
+		count++;
+	}
+	return count;
+}
+
+/**
+ * @brief Applies Delta entries read from a payload.
+ *
+ * @param data First entry.
+ * @param end End of the payload.
+ * @param count Number of entries.
+ * @param vec Vector to update.
+ * @return Pointer past the last entry read.
+ */
+static const char* applyDeltas(const char* data, const char* end, uint64_t count, std::vector<double>& vec) {
+	if (static_cast<size_t>(end - data) < count * sizeof(Delta))
+		throw DistException(DEx::Network, "Truncated message");
+
+	for (uint64_t k{ 0 }; k < count; k++, data += sizeof(Delta)) {
+		Delta delta;
+		std::memcpy(&delta, data, sizeof(delta));
+		if (delta.index >= vec.size())
+			throw DistException(DEx::OutOfBound, "Delta index out of range");
+		vec[delta.index] = delta.value;
+	}
+	return data;
+}
+
+#pragma region DistCoordinator
+
+DistCoordinator::DistCoordinator(unsigned long port, size_t numWorkers, const std::string& fileName) : listenFD{ -1 }, fileName{ fileName }, bytesSent{ 0 }, bytesRecv{ 0 } {
+	listenFD = socket(AF_INET, SOCK_STREAM, 0);
+	if (listenFD < 0)
+		throw DistException(DEx::Network, "Unable to create the listening socket");
+
+	int on{ 1 };
+	setsockopt(listenFD, SOL_SOCKET, SO_REUSEADDR, &on, sizeof(on));
+
+	sockaddr_in addr{};
+	addr.sin_family = AF_INET;
+	addr.sin_addr.s_addr = htonl(INADDR_ANY);
+	addr.sin_port = htons(static_cast<uint16_t>(port));
+	if (bind(listenFD, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) < 0 || listen(listenFD, DIST_BACKLOG) < 0) {
+		close(listenFD);
+		throw DistException(DEx::Network, "Unable to listen on port " + std::to_string(port));
+	}
+
+	PRINT_OUT("Distributed: Coordinator listening on port %lu -- Waiting for %zu workers", port, numWorkers);
+
+	double startTime{ Clock::getTime() };
+	while (workers.size() < numWorkers) {
+		double left{ DIST_ACCEPT_TL - Clock::timeElapsed(startTime) };
+		if (left < EPSILON)
+			break;
+
+		pollfd pfd{ .fd = listenFD, .events = POLLIN, .revents = 0 };
+		if (poll(&pfd, 1, static_cast<int>(left * 1000)) <= 0)
+			continue;
+
+		int fd{ accept(listenFD, nullptr, nullptr) };
+		if (fd < 0)
+			continue;
+		setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &on, sizeof(on));
+
+		MsgHeader		  header;
+		std::vector<char> payload;
+		bool			  received{ false };
+		try {
+			received = recvMsg(fd, header, payload, bytesRecv);
+		} catch (const DistException& ex) {
+			PRINT_WARN("Distributed: Connection rejected (%s)", ex.what());
+		}
+		if (!received || header.type != static_cast<uint32_t>(MsgType::Hello)) {
+			close(fd);
+			continue;
+		}
+		if (std::string(payload.begin(), payload.end()) != fileName) {
+			PRINT_WARN("Distributed: Worker rejected -- Instance %s instead of %s", std::string(payload.begin(), payload.end()).c_str(), fileName.c_str());
+			sendMsg(fd, MsgType::Stop, {}, bytesSent);
+			close(fd);
+			continue;
+		}
+
+		workers.push_back({ .fd = fd,
+							.ref = std::vector<double>(),
+							.inc = std::vector<double>(),
+							.busy = false,
+							.deadline = 0.0,
+							.phase = DetBudget::Phase::FMIP,
+							.policy = PolicyPortfolio::Policy::RandomRho,
+							.refSol = { .sol = std::vector<double>(), .slackSum = CPX_INFBOUND, .oMIPCost = CPX_INFBOUND },
+							.jobs = 0 });
+		PRINT_OUT("Distributed: Worker %zu connected", workers.size() - 1);
+	}
+
+	if (workers.size() < numWorkers)
+		PRINT_WARN("Distributed: Only %zu of %zu workers connected", workers.size(), numWorkers);
+}
+
+void DistCoordinator::dispatch(DetBudget::Phase phase, const Solution& refSol, const Solution& incumbent, double rho, PolicyPortfolio& portfolio, Random& rnd, double timeLimit) {
+	for (size_t w{ 0 }; w < workers.size(); w++) {
+		RemoteWorker& worker{ workers[w] };
+		if (worker.fd < 0)
+			continue;
+
+		JobMsg job{ .phase = static_cast<uint32_t>(phase),
+					.policy = static_cast<uint32_t>(portfolio.pick(phase)),
+					.seed = static_cast<uint64_t>(rnd.Int(0, std::numeric_limits<int>::max())),
+					.solSize = refSol.sol.size(),
+					.rho = rho,
+					.timeLimit = timeLimit,
+					.incSlack = incumbent.slackSum,
+					.incCost = incumbent.oMIPCost,
+					.refDeltas = 0,
+					.incDeltas = 0 };
+
+		std::vector<char> payload(sizeof(JobMsg));
+		job.refDeltas = appendDeltas(payload, worker.ref, refSol.sol);
+		worker.inc.resize(refSol.sol.size(), 0.0);
+		if (incumbent.sol.size() == refSol.sol.size())
+			job.incDeltas = appendDeltas(payload, worker.inc, incumbent.sol);
+		std::memcpy(payload.data(), &job, sizeof(job));
+
+		if (!sendMsg(worker.fd, MsgType::Job, payload, bytesSent)) {
+			drop(w, "send failed");
+			continue;
+		}
+
+		worker.busy = true;
+		worker.deadline = Clock::getTime() + timeLimit + DIST_GRACE_TL;
+		worker.phase = phase;
+		worker.policy = static_cast<PolicyPortfolio::Policy>(job.policy);
+		worker.refSol = { .sol = std::vector<double>(), .slackSum = incumbent.slackSum, .oMIPCost = incumbent.oMIPCost };
+
+#if ACS_VERBOSE >= VERBOSE
+		PRINT_INFO("Distributed: Job sent to worker %zu [%s - %s] -- Deltas: %zu|%zu", w, DetBudget::phaseName(phase), PolicyPortfolio::policyName(worker.policy), job.refDeltas, job.incDeltas);
+#endif
+	}
+}
+
+const std::vector<DistCoordinator::RemoteResult>& DistCoordinator::collect(PolicyPortfolio& portfolio) {
+	results.clear();
+	solutions.clear();
+
+	std::vector<pollfd> pfds;
+	std::vector<size_t> ids;
+	while (true) {
+		pfds.clear();
+		ids.clear();
+		double now{ Clock::getTime() };
+		double deadline{ CPX_INFBOUND };
+
+		for (size_t w{ 0 }; w < workers.size(); w++) {
+			if (!workers[w].busy)
+				continue;
+			if (workers[w].deadline < now) {
+				drop(w, "no answer");
+				continue;
+			}
+			pfds.push_back({ .fd = workers[w].fd, .events = POLLIN, .revents = 0 });
+			ids.push_back(w);
+			deadline = std::min(deadline, workers[w].deadline);
+		}
+		if (pfds.empty())
+			break;
+
+		if (poll(pfds.data(), pfds.size(), static_cast<int>(std::max(1.0, (deadline - now) * 1000))) <= 0)
+			continue;
+
+		for (size_t k{ 0 }; k < pfds.size(); k++) {
+			if (!pfds[k].revents)
+				continue;
+
+			RemoteWorker&	  worker{ workers[ids[k]] };
+			MsgHeader		  header;
+			std::vector<char> payload;
+			bool			  received{ false };
+			try {
+				received = recvMsg(worker.fd, header, payload, bytesRecv);
+			} catch (const DistException& ex) {
+				drop(ids[k], ex.what());
+				continue;
+			}
+			if (!received || header.type != static_cast<uint32_t>(MsgType::Result) || payload.size() < sizeof(ResultMsg)) {
+				drop(ids[k], "connection lost");
+				continue;
+			}
+
+			ResultMsg res;
+			std::memcpy(&res, payload.data(), sizeof(res));
+			if (res.solveCode == DIST_JOB_REJECTED) {
+				PRINT_WARN("Distributed: Job rejected by worker %zu", ids[k]);
+				// The worker cleared its mirrors: the next job sends the whole vectors
+				worker.ref.clear();
+				worker.inc.clear();
+				worker.busy = false;
+				continue;
+			}
+			RemoteResult result{ .worker = ids[k], .policy = worker.policy, .solveCode = res.solveCode, .ticks = res.ticks, .solveTime = res.solveTime, .improvement = 0.0, .hasSol = res.hasSol != 0 };
+
+			if (result.hasSol) {
+				if (res.solSize > DIST_MAX_MSG_SIZE / sizeof(double)) {
+					drop(ids[k], "solution size out of range");
+					continue;
+				}
+				Solution sol{ .sol = worker.ref, .slackSum = res.slackSum, .oMIPCost = res.oMIPCost };
+				sol.sol.resize(res.solSize, 0.0);
+				try {
+					applyDeltas(payload.data() + sizeof(ResultMsg), payload.data() + payload.size(), res.deltas, sol.sol);
+				} catch (const DistException& ex) {
+					drop(ids[k], ex.what());
+					continue;
+				}
+				result.improvement = DetBudget::improvement(worker.refSol, sol);
+				solutions.push_back(std::move(sol));
+			}
+
+			portfolio.record(worker.phase, worker.policy, result.improvement, result.solveTime, result.ticks, MIP::isINForUNBD(result.solveCode));
+			worker.busy = false;
+			worker.jobs++;
+			results.push_back(result);
+		}
+	}
+	return results;
+}
+
+size_t DistCoordinator::getNumWorkers() const {
+	return static_cast<size_t>(std::count_if(workers.begin(), workers.end(), [](const RemoteWorker& w) { return w.fd >= 0; }));
+}
+
+void DistCoordinator::printStats() const {
+	size_t jobs{ 0 };
+	for (const auto& worker : workers)
+		jobs += worker.jobs;
+	PRINT_OUT("Distributed -- Workers: %zu [connected: %zu] -- Jobs: %zu -- Sent: %.2f MB -- Received: %.2f MB", workers.size(), getNumWorkers(), jobs, bytesSent / 1e6, bytesRecv / 1e6);
+}
+
+void DistCoordinator::drop(size_t w, const char* reason) {
+	PRINT_WARN("Distributed: Worker %zu dropped (%s)", w, reason);
+	close(workers[w].fd);
+	workers[w].fd = -1;
+	workers[w].busy = false;
+}
+
+DistCoordinator::~DistCoordinator() {
+	for (auto& worker : workers) {
+		if (worker.fd < 0)
+			continue;
+		sendMsg(worker.fd, MsgType::Stop, {}, bytesSent);
+		close(worker.fd);
+	}
+	if (listenFD >= 0)
+		close(listenFD);
+}
+
+#pragma endregion
+
+#pragma region DistWorker
+
+DistWorker::DistWorker(Args& CLIArgs) : CLIArgs{ CLIArgs }, fd{ -1 } {
+	addrinfo	hints{};
+	addrinfo*	info{ nullptr };
+	std::string port{ std::to_string(CLIArgs.worker) };
+	hints.ai_family = AF_UNSPEC;
+	hints.ai_socktype = SOCK_STREAM;
+	if (getaddrinfo(CLIArgs.host.c_str(), port.c_str(), &hints, &info) || !info)
+		throw DistException(DEx::Network, "Unable to resolve " + CLIArgs.host);
+
+	// The coordinator may not be listening yet
+	double startTime{ Clock::getTime() };
+	while (fd < 0 && Clock::timeElapsed(startTime) < DIST_CONNECT_TL) {
+		for (addrinfo* ai{ info }; ai && fd < 0; ai = ai->ai_next) {
+			fd = socket(ai->ai_family, ai->ai_socktype, ai->ai_protocol);
+			if (fd >= 0 && connect(fd, ai->ai_addr, ai->ai_addrlen) < 0) {
+				close(fd);
+				fd = -1;
+			}
+		}
+		if (fd < 0)
+			usleep(500000);
+	}
+	freeaddrinfo(info);
+
+	if (fd < 0)
+		throw DistException(DEx::Network, "Unable to reach the coordinator at " + CLIArgs.host + ":" + port);
+
+	int on{ 1 };
+	setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &on, sizeof(on));
+
+	size_t bytes{ 0 };
+	if (!sendMsg(fd, MsgType::Hello, std::vector<char>(CLIArgs.fileName.begin(), CLIArgs.fileName.end()), bytes))
+		throw DistException(DEx::Network, "Handshake with the coordinator failed");
+
+	PRINT_OUT("Distributed: Worker connected to %s:%s", CLIArgs.host.c_str(), port.c_str());
+}
+
+size_t DistWorker::run() {
+	size_t			  jobs{ 0 };
+	size_t			  bytes{ 0 };
+	MsgHeader		  header;
+	std::vector<char> payload;
+
+	while (Clock::timeRemaining(CLIArgs.timeLimit) > EPSILON) {
+		pollfd pfd{ .fd = fd, .events = POLLIN, .revents = 0 };
+		if (poll(&pfd, 1, static_cast<int>(Clock::timeRemaining(CLIArgs.timeLimit) * 1000)) <= 0)
+			continue;
+
+		if (!recvMsg(fd, header, payload, bytes) || header.type == static_cast<uint32_t>(MsgType::Stop))
+			break;
+		if (header.type != static_cast<uint32_t>(MsgType::Job))
+			continue;
+
+		// Every job gets a Result, a rejected one too: the coordinator would wait for it until its deadline
+		JobMsg job;
+		try {
+			if (payload.size() < sizeof(JobMsg))
+				throw DistException(DEx::Network, "Truncated job");
+			std::memcpy(&job, payload.data(), sizeof(job));
+			if ((job.phase != static_cast<uint32_t>(DetBudget::Phase::FMIP) && job.phase != static_cast<uint32_t>(DetBudget::Phase::OMIP)) || job.policy >= static_cast<uint32_t>(PolicyPortfolio::Policy::_count) || job.solSize > DIST_MAX_MSG_SIZE / sizeof(double))
+				throw DistException(DEx::WrongArgsValue, "Phase " + std::to_string(job.phase) + ", policy " + std::to_string(job.policy) + ", size " + std::to_string(job.solSize));
+
+			prevRef = ref;
+			ref.resize(job.solSize, 0.0);
+			inc.resize(job.solSize, 0.0);
+			const char* data{ applyDeltas(payload.data() + sizeof(JobMsg), payload.data() + payload.size(), job.refDeltas, ref) };
+			applyDeltas(data, payload.data() + payload.size(), job.incDeltas, inc);
+		} catch (const DistException& ex) {
+			PRINT_WARN("Distributed: Job rejected (%s)", ex.what());
+			// The mirrors may be half updated: both sides restart from empty vectors
+			ref.clear();
+			inc.clear();
+
+			ResultMsg		  res{ .solveCode = DIST_JOB_REJECTED, .hasSol = 0, .slackSum = CPX_INFBOUND, .oMIPCost = CPX_INFBOUND, .ticks = 0.0, .solveTime = 0.0, .solSize = 0, .deltas = 0 };
+			std::vector<char> reply(sizeof(ResultMsg));
+			std::memcpy(reply.data(), &res, sizeof(res));
+			if (!sendMsg(fd, MsgType::Result, reply, bytes))
+				PRINT_WARN("Distributed: Result not delivered to the coordinator");
+			continue;
+		}
+
+		solveJob(job);
+		jobs++;
+	}
+
+	PRINT_OUT("Distributed: Worker done -- Jobs: %zu", jobs);
+	return jobs;
+}
+
+void DistWorker::solveJob(const JobMsg& job) {
+	DetBudget::Phase phase{ static_cast<DetBudget::Phase>(job.phase) };
+	const char*		 type{ DetBudget::phaseName(phase) };
+	double			 timeLimit{ std::min(job.timeLimit, Clock::timeRemaining(CLIArgs.timeLimit)) };
+
+	ResultMsg		  res{ .solveCode = 0, .hasSol = 0, .slackSum = CPX_INFBOUND, .oMIPCost = CPX_INFBOUND, .ticks = 0.0, .solveTime = 0.0, .solSize = 0, .deltas = 0 };
+	std::vector<char> payload(sizeof(ResultMsg));
+
+	if (timeLimit > EPSILON) {
+		std::unique_ptr<MIP> model;
+		if (phase == DetBudget::Phase::FMIP)
+			model = std::make_unique<FMIP>(CLIArgs.fileName);
+		else
+			model = std::make_unique<OMIP>(CLIArgs.fileName);
+		model->setNumCores(CLIArgs.numCores);
+
+		// Same fixings and objective limits as the local subMIPs (see MTContext)
+		if (job.incSlack < CPX_INFBOUND) {
+			model->addMIPStart(inc);
+			FixPolicy::fixSlackUpperBound(type, *model, inc);
+		}
+
+		// Root LP and blocks are computed at the first job needing them; without them the window policy is used
+		PolicyPortfolio::Policy policy{ static_cast<PolicyPortfolio::Policy>(job.policy) };
+		if (PolicyPortfolio::isLPGuided(policy))
+			FixPolicy::solveRootLP(CLIArgs.fileName, Clock::timeRemaining(CLIArgs.timeLimit) * ROOT_LP_TL_FRAC);
+		if (policy == PolicyPortfolio::Policy::Block)
+			FixPolicy::detectBlocks(CLIArgs.fileName);
+		if (!PolicyPortfolio::isAvailable(phase, policy))
+			policy = PolicyPortfolio::Policy::RandomRho;
+
+		// The free block is drawn from the seed: the local workers cycle over the blocks
+		size_t numBlocks{ FixPolicy::getBlocks().vars.size() };
+		Random rnd(job.seed);
+		PolicyPortfolio::apply(policy, 0, type, *model, ref, prevRef, job.rho, numBlocks ? job.seed % numBlocks : 0, rnd);
+
+		if (phase == DetBudget::Phase::FMIP) {
+			model->setObjStop(EPSILON);
+			if (job.incSlack < CPX_INFBOUND)
+				model->setCutoff(job.incSlack);
+		} else if (job.incSlack <= EPSILON && job.incCost < CPX_INFBOUND)
+			model->setCutoff(job.incCost);
+
+		double solveTime{ Clock::getTime() };
+		res.solveCode = model->solve(timeLimit, std::clamp(CLIArgs.detScale * DET_TL(model->getNumNonZeros()), MIN_DET_TL, MAX_DET_TL));
+		res.solveTime = Clock::timeElapsed(solveTime);
+		res.ticks = model->getLastDetTime();
+
+		if (!MIP::isINForUNBD(res.solveCode)) {
+			std::vector<double> sol{ model->getSol() };
+			if (phase == DetBudget::Phase::FMIP) {
+				res.slackSum = model->getObjValue();
+				res.oMIPCost = static_cast<FMIP&>(*model).getOMIPCost(sol);
+			} else {
+				res.slackSum = static_cast<OMIP&>(*model).getSlackSum();
+				res.oMIPCost = model->getObjValue();
+			}
+
+			std::vector<double> base{ ref };
+			res.hasSol = 1;
+			res.solSize = sol.size();
+			res.deltas = appendDeltas(payload, base, sol);
+			PRINT_OUT("Distributed: %s job -- Objective|SlackSum: %12.2f|%-10.2f -- Deltas: %zu", type, res.oMIPCost, res.slackSum, res.deltas);
+		}
+	}
+
+	std::memcpy(payload.data(), &res, sizeof(res));
+	size_t bytes{ 0 };
+	if (!sendMsg(fd, MsgType::Result, payload, bytes))
+		PRINT_WARN("Distributed: Result not delivered to the coordinator");
+}
+
+DistWorker::~DistWorker() {
+	if (fd >= 0)
+		close(fd);
+}
+
+#pragma endregion
@@ -0,0 +1,85 @@
+#include "../include/ElasticWorkers.hpp"
+
+ElasticWorkers::ElasticWorkers(size_t initWorkers, size_t maxWorkers, bool enabled) : maxWorkers{ std::max(initWorkers, maxWorkers) }, enabled{ enabled } {
+	stats.fill({ .numActive = initWorkers,
+				 .rounds = 0,
+				 .sumActive = 0,
+				 .minActive = initWorkers,
+				 .maxActive = initWorkers,
+				 .lastRate = 0.0,
+				 .lastGrow = false,
+				 .growCap = std::max(initWorkers, maxWorkers),
+				 .solves = 0,
+				 .limits = 0,
+				 .improvement = 0.0,
+				 .nnz = 0 });
+}
+
+size_t ElasticWorkers::getNumActive(DetBudget::Phase phase) {
+	std::lock_guard<std::mutex> lock(elasticMTX);
+	return stats[index(phase)].numActive;
+}
+
+void ElasticWorkers::record(DetBudget::Phase phase, bool limitHit, double improvement, size_t nnz) {
+	std::lock_guard<std::mutex> lock(elasticMTX);
+	PhaseStats&					st{ stats[index(phase)] };
+
+	st.solves++;
+	st.limits += limitHit;
+	st.improvement += improvement;
+	st.nnz = std::max(st.nnz, nnz);
+}
+
+size_t ElasticWorkers::endRound(DetBudget::Phase phase, double roundTime) {
+	std::lock_guard<std::mutex> lock(elasticMTX);
+	PhaseStats&					st{ stats[index(phase)] };
+
+	size_t numActive{ st.numActive };
+	st.rounds++;
+	st.sumActive += numActive;
+	st.minActive = std::min(st.minActive, numActive);
+	st.maxActive = std::max(st.maxActive, numActive);
+
+	if (enabled && st.solves) {
+		double rate{ (roundTime > EPSILON) ? st.improvement / roundTime : 0.0 };
+		double limitFrac{ static_cast<double>(st.limits) / st.solves };
+		// Fewer slots than ELASTIC_MIN_WORKERS: the floor must not exceed them
+		size_t minActive{ std::min<size_t>(ELASTIC_MIN_WORKERS, maxWorkers) };
+		size_t maxActive{ maxWorkers };
+		if (st.nnz)
+			maxActive = std::clamp<size_t>(static_cast<size_t>(ELASTIC_NNZ_BUDGET / st.nnz), minActive, maxWorkers);
+
+		size_t next{ numActive };
+		if (limitFrac >= ELASTIC_SHRINK_FRAC) {
+			next = std::max(minActive, numActive / 2);
+			st.growCap = maxWorkers;
+		} else if (st.lastGrow && rate < st.lastRate) {
+			next = std::max(minActive, numActive / 2);
+			st.growCap = next;
+		} else if (limitFrac <= ELASTIC_GROW_FRAC)
+			next = std::min({ maxActive, st.growCap, 2 * numActive });
+		next = std::max(minActive, std::min(next, maxActive));
+
+		st.lastGrow = (next > numActive);
+		st.lastRate = rate;
+		st.numActive = next;
+
+#if ACS_VERBOSE >= VERBOSE
+		if (next != numActive)
+			PRINT_INFO("ElasticWorkers [%s] - %zu -> %zu active workers (time limit hit: %4.2f - improvement rate: %8.6f/s)", DetBudget::phaseName(phase), numActive, next, limitFrac, rate);
+#endif
+	}
+
+	st.solves = 0;
+	st.limits = 0;
+	st.improvement = 0.0;
+	st.nnz = 0;
+	return st.numActive;
+}
+
+size_t ElasticWorkers::index(DetBudget::Phase phase) {
+	size_t idx{ static_cast<size_t>(phase) };
+	if (idx >= NUM_PHASES)
+		throw ACSException(ACSException::ExceptionType::WrongArgsValue, "ElasticWorkers handles only the FMIP and OMIP phases", "ElasticWorkers");
+	return idx;
+}
@@ -0,0 +1,137 @@
+#include "../include/ElitePool.hpp"
+
+ElitePool::ElitePool(size_t capacity) : capacity{ capacity }, numVars{ 0 } {
+	members.reserve(capacity);
+	stats = { .offered = 0, .duplicates = 0, .inserted = 0, .evicted = 0, .rejected = 0 };
+}
+
+void ElitePool::loadVarTypes(const std::string& fileName) {
+	if (!isEnabled())
+		return;
+
+	MIP model(fileName);
+	numVars = model.getMIPNumVars();
+	intVars = model.getMIPIntVars();
+}
+
+bool ElitePool::insert(const Solution& sol) {
+	if (!isEnabled() || sol.sol.empty() || sol.slackSum >= CPX_INFBOUND)
+		return false;
+
+	uint64_t					h{ hash(sol) };
+	std::lock_guard<std::mutex> lock(poolMTX);
+	stats.offered++;
+
+	if (!seen.insert(h).second) {
+		stats.duplicates++;
+		return false;
+	}
+
+	if (members.size() < capacity) {
+		members.push_back({ .sol = sol, .hash = h });
+		stats.inserted++;
+		return true;
+	}
+
+	// Full pool: replace the closest member among the worse ones (the most redundant for the pool)
+	size_t victim{ members.size() };
+	size_t victimDist{ std::numeric_limits<size_t>::max() };
+	for (size_t i{ 0 }; i < members.size(); i++) {
+		if (!isBetter(sol, members[i].sol))
+			continue;
+		size_t dist{ distance(sol, members[i].sol) };
+		if (dist < victimDist || (dist == victimDist && isBetter(members[victim].sol, members[i].sol))) {
+			victim = i;
+			victimDist = dist;
+		}
+	}
+
+	if (victim == members.size()) {
+		stats.rejected++;
+		return false;
+	}
+
+	members[victim] = { .sol = sol, .hash = h };
+	stats.evicted++;
+	stats.inserted++;
+	return true;
+}
+
+uint64_t ElitePool::hash(const Solution& sol) const {
+	size_t	 len{ numVars ? std::min(numVars, sol.sol.size()) : sol.sol.size() };
+	uint64_t h{ Hash::OFFSET };
+
+	for (size_t j{ 0 }; j < len; j++)
+		h = Hash::mix(h, sol.sol[j], ELITE_HASH_GRID);
+	return h;
+}
+
+std::vector<Solution> ElitePool::getBest(size_t k) {
+	std::lock_guard<std::mutex> lock(poolMTX);
+
+	std::vector<size_t> order(members.size());
+	std::iota(order.begin(), order.end(), 0);
+	k = std::min(k, order.size());
+	std::partial_sort(order.begin(), order.begin() + k, order.end(), [&](size_t a, size_t b) { return isBetter(members[a].sol, members[b].sol); });
+
+	std::vector<Solution> best;
+	best.reserve(k);
+	for (size_t i{ 0 }; i < k; i++)
+		best.push_back(members[order[i]].sol);
+	return best;
+}
+
+std::vector<Solution> ElitePool::getFarthest(const Solution& ref, size_t k) {
+	std::lock_guard<std::mutex> lock(poolMTX);
+
+	std::vector<std::pair<size_t, size_t>> dists; // (distance, member)
+	dists.reserve(members.size());
+	for (size_t i{ 0 }; i < members.size(); i++) {
+		size_t dist{ distance(ref, members[i].sol) };
+		if (dist)
+			dists.emplace_back(dist, i);
+	}
+	k = std::min(k, dists.size());
+	std::partial_sort(dists.begin(), dists.begin() + k, dists.end(), [](const auto& a, const auto& b) { return a.first > b.first || (a.first == b.first && a.second < b.second); });
+
+	std::vector<Solution> farthest;
+	farthest.reserve(k);
+	for (size_t i{ 0 }; i < k; i++)
+		farthest.push_back(members[dists[i].second].sol);
+	return farthest;
+}
+
+size_t ElitePool::getSize() {
+	std::lock_guard<std::mutex> lock(poolMTX);
+	return members.size();
+}
+
+#pragma region ElitePoolPrivateSec
+
+bool ElitePool::isBetter(const Solution& a, const Solution& b) {
+	if (std::abs(a.slackSum - b.slackSum) >= EPSILON)
+		return a.slackSum < b.slackSum;
+	return a.oMIPCost < b.oMIPCost;
+}
+
+size_t ElitePool::distance(const Solution& a, const Solution& b) const {
+	size_t dist{ 0 };
+
+	if (!intVars.empty()) {
+		for (int j : intVars)
+			if (std::abs(a.sol[j] - b.sol[j]) > 0.5)
+				dist++;
+		return dist;
+	}
+
+	// Not loaded or no integer variables: any value difference counts
+	size_t len{ std::min(a.sol.size(), b.sol.size()) };
+	if (numVars)
+		len = std::min(len, numVars);
+	for (size_t j{ 0 }; j < len; j++)
+		if (std::abs(a.sol[j] - b.sol[j]) >= EPSILON)
+			dist++;
+	return dist;
+}
+
+#pragma endregion
@@ -7,9 +7,11 @@ using MIPEx = MIPException::ExceptionType;
 
 std::vector<double> FMIP::ogObjFun;
 
+static std::once_flag ogObjFunFlag;
+
 FMIP::FMIP(const std::string fileName) : MIP(fileName) {
 	MIPNumVars = getNumCols();
-	if (ogObjFun.empty()) ogObjFun = getObjFunction();
+	std::call_once(ogObjFunFlag, [this]() { ogObjFun = getObjFunction(); });
 	setup();
 
 #if ACS_VERBOSE == DEBUG
@@ -27,7 +29,7 @@ FMIP::FMIP(const FMIP& otherFMIP) : MIP(otherFMIP) {
 
 FMIP::FMIP(const MIP& otherMIP) : MIP(otherMIP) {
 	MIPNumVars = getNumCols();
-	if (ogObjFun.empty()) ogObjFun = getObjFunction();
+	std::call_once(ogObjFunFlag, [this]() { ogObjFun = getObjFunction(); });
 	setup();
 
 #if ACS_VERBOSE == DEBUG
@@ -44,11 +46,5 @@ void FMIP::setup() {
 	std::vector<double> obj(getNumCols(), FMIP_VAR_OBJ_COEFF);
 	setObjFunction(obj);
 
-	for (size_t i{ 0 }; i < getNumRows(); i++) {
-		addCol(i, 1, FMIP_SLACK_OBJ_COEFF, 0.0, CPX_INFBOUND, "SP_" + std::to_string(i + 1));
-	}
-
-	for (size_t i{ 0 }; i < getNumRows(); i++) {
-		addCol(i, -1, FMIP_SLACK_OBJ_COEFF, 0.0, CPX_INFBOUND, "SN_" + std::to_string(i + 1));
-	}
+	addSlackCols(FMIP_SLACK_OBJ_COEFF);
 }
\ No newline at end of file
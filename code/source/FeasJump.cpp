@@ -0,0 +1,297 @@
+#include "../include/FeasJump.hpp"
+
+#define LE 'L'
+#define EQ 'E'
+#define GE 'G'
+
+FeasJump::FeasJump(const std::string& fileName) : FeasJump(MIP(fileName)) {}
+
+FeasJump::FeasJump(MIP&& model)
+	: numVars{ model.getMIPNumVars() },
+	  numRows{ model.getOgNumRows() },
+	  rowBeg{ model.getMIPRowBeg() },
+	  rowInd{ model.getMIPRowInd() },
+	  rowVal{ model.getMIPRowVal() },
+	  sense{ model.getMIPSense() },
+	  rhs{ model.getMIPRhs() } {
+
+	lb.resize(numVars);
+	ub.resize(numVars);
+	for (size_t j{ 0 }; j < numVars; j++) {
+		auto [lowerBound, upperBound] = model.getVarBounds(j);
+		lb[j] = lowerBound;
+		ub[j] = upperBound;
+	}
+	isInt.assign(numVars, 0);
+	for (int j : model.getMIPIntVars())
+		isInt[j] = 1;
+	obj = model.getObjFunction();
+	obj.resize(numVars);
+
+	// CSC copy of the shared CSR: moves update the activities of the rows of a column
+	colBeg.assign(numVars + 1, 0);
+	for (int j : rowInd)
+		colBeg[j + 1]++;
+	std::partial_sum(colBeg.begin(), colBeg.end(), colBeg.begin());
+
+	colRow.resize(rowInd.size());
+	colVal.resize(rowInd.size());
+	std::vector<int> next(colBeg.begin(), colBeg.end() - 1);
+	for (size_t c{ 0 }; c < numRows; c++) {
+		int end{ (c == numRows - 1) ? static_cast<int>(rowInd.size()) : rowBeg[c + 1] };
+		for (int k{ rowBeg[c] }; k < end; k++) {
+			colRow[next[rowInd[k]]] = static_cast<int>(c);
+			colVal[next[rowInd[k]]++] = rowVal[k];
+		}
+	}
+}
+
+double FeasJump::rowViol(const size_t c, const double act) const {
+	switch (sense[c]) {
+		case LE:
+			return std::max(0.0, act - rhs[c]);
+		case GE:
+			return std::max(0.0, rhs[c] - act);
+		case EQ:
+			return std::abs(act - rhs[c]);
+		default:
+			return 0.0;
+	}
+}
+
+double FeasJump::weightedViol(const size_t j, const double v, const std::vector<double>& x, const std::vector<double>& act, const std::vector<double>& weight) const {
+	double viol{ 0.0 };
+	for (int k{ colBeg[j] }; k < colBeg[j + 1]; k++)
+		viol += weight[colRow[k]] * rowViol(colRow[k], act[colRow[k]] + colVal[k] * (v - x[j]));
+	return viol;
+}
+
+double FeasJump::jumpValue(const size_t j, const std::vector<double>& x, const std::vector<double>& act, const std::vector<double>& weight, std::vector<Breakpoint>& bps, double& gain) const {
+	gain = 0.0;
+	if (colBeg[j] == colBeg[j + 1])
+		return x[j];
+
+	// Each constraint adds a convex piecewise-linear term: slope sL before its breakpoint, sR after
+	bps.clear();
+	double slope{ 0.0 };
+	for (int k{ colBeg[j] }; k < colBeg[j + 1]; k++) {
+		size_t c{ static_cast<size_t>(colRow[k]) };
+		double a{ colVal[k] };
+		double w{ weight[c] };
+		double t{ (rhs[c] - (act[c] - a * x[j])) / a };
+		double sL{ 0.0 }, sR{ 0.0 };
+		switch (sense[c]) {
+			case LE:
+				(a > 0 ? sR : sL) = w * a;
+				break;
+			case GE:
+				(a > 0 ? sL : sR) = -w * a;
+				break;
+			case EQ:
+				sL = -w * std::abs(a);
+				sR = w * std::abs(a);
+				break;
+			default:
+				continue;
+		}
+		slope += sL;
+		bps.push_back({ .value = t, .slope = sR - sL });
+	}
+	std::sort(bps.begin(), bps.end(), [](const Breakpoint& a, const Breakpoint& b) { return a.value < b.value; });
+
+	// Minimizers: [vLow, vHigh], where the slope turns non-negative and then positive
+	double vLow{ -CPX_INFBOUND }, vHigh{ CPX_INFBOUND };
+	for (const auto& bp : bps) {
+		if (slope < 0.0 && slope + bp.slope >= 0.0)
+			vLow = bp.value;
+		slope += bp.slope;
+		if (slope > 0.0) {
+			vHigh = bp.value;
+			break;
+		}
+	}
+
+	double v{ std::clamp(std::clamp(x[j], vLow, std::max(vLow, vHigh)), lb[j], ub[j]) };
+	if (isInt[j]) {
+		double vFloor{ std::max(lb[j], std::floor(v)) };
+		double vCeil{ std::min(ub[j], std::ceil(v)) };
+		v = (weightedViol(j, vFloor, x, act, weight) <= weightedViol(j, vCeil, x, act, weight)) ? vFloor : vCeil;
+	}
+
+	gain = weightedViol(j, x[j], x, act, weight) - weightedViol(j, v, x, act, weight);
+	return v;
+}
+
+void FeasJump::walk(const std::vector<double>& start, const double deadline, const size_t maxSteps, Random& rnd, Solution& best) {
+	std::vector<double> x(numVars);
+	for (size_t j{ 0 }; j < numVars; j++) {
+		x[j] = std::clamp(start[j] < CPX_INFBOUND ? start[j] : 0.0, lb[j], ub[j]);
+		if (isInt[j])
+			x[j] = std::round(x[j]);
+	}
+
+	std::vector<double> act(numRows, 0.0);
+	for (size_t j{ 0 }; j < numVars; j++)
+		for (int k{ colBeg[j] }; k < colBeg[j + 1]; k++)
+			act[colRow[k]] += colVal[k] * x[j];
+
+	// Violated constraints: vector + position, for O(1) insertion, removal and sampling
+	std::vector<int> violated;
+	std::vector<int> violPos(numRows, -1);
+	double			 totViol{ 0.0 };
+	for (size_t c{ 0 }; c < numRows; c++) {
+		double viol{ rowViol(c, act[c]) };
+		totViol += viol;
+		if (viol > FJ_FEAS_TOL) {
+			violPos[c] = violated.size();
+			violated.push_back(c);
+		}
+	}
+
+	std::vector<double>		weight(numRows, 1.0);
+	std::vector<Breakpoint> bps;
+	std::vector<double>		bestX{ x };
+	double					bestViol{ totViol };
+	std::vector<int>		dirty; // Variables moved since bestX was saved
+	bool					fullCopy{ false };
+	size_t					moves{ 0 }, weightUpdates{ 0 };
+
+	for (size_t step{ 0 }; !violated.empty() && step < maxSteps; step++) {
+		if (step % FJ_CHECK_STEPS == 0 && deadline < CPX_INFBOUND && (A_Feasible || Clock::getTime() >= deadline))
+			break;
+
+		int	   bestVar{ -1 };
+		double bestVal{ 0.0 };
+		double bestGain{ FJ_FEAS_TOL };
+		for (size_t s{ 0 }; s < FJ_SAMPLE_ROWS; s++) {
+			size_t c{ static_cast<size_t>(violated[rnd.Int(0, violated.size() - 1)]) };
+			int	   begin{ rowBeg[c] };
+			int	   len{ ((c == numRows - 1) ? static_cast<int>(rowInd.size()) : rowBeg[c + 1]) - begin };
+			// An empty row has no variable to move (it stays violated whatever the assignment)
+			if (!len)
+				continue;
+			int offset{ rnd.Int(0, len - 1) };
+			for (int k{ 0 }; k < std::min(len, FJ_SAMPLE_VARS); k++) {
+				size_t j{ static_cast<size_t>(rowInd[begin + (offset + k) % len]) };
+				double gain;
+				double v{ jumpValue(j, x, act, weight, bps, gain) };
+				if (gain > bestGain) {
+					bestGain = gain;
+					bestVar = j;
+					bestVal = v;
+				}
+			}
+		}
+
+		if (bestVar < 0) {
+			for (int c : violated)
+				weight[c] += FJ_WEIGHT_INC;
+			weightUpdates++;
+			continue;
+		}
+
+		double delta{ bestVal - x[bestVar] };
+		x[bestVar] = bestVal;
+		for (int k{ colBeg[bestVar] }; k < colBeg[bestVar + 1]; k++) {
+			int	   c{ colRow[k] };
+			double oldViol{ rowViol(c, act[c]) };
+			act[c] += colVal[k] * delta;
+			double newViol{ rowViol(c, act[c]) };
+			totViol += newViol - oldViol;
+
+			if (newViol > FJ_FEAS_TOL && violPos[c] < 0) {
+				violPos[c] = violated.size();
+				violated.push_back(c);
+			} else if (newViol <= FJ_FEAS_TOL && violPos[c] >= 0) {
+				violPos[violated.back()] = violPos[c];
+				violated[violPos[c]] = violated.back();
+				violated.pop_back();
+				violPos[c] = -1;
+			}
+		}
+		moves++;
+
+		if (!fullCopy) {
+			dirty.push_back(bestVar);
+			if (dirty.size() > numVars) {
+				fullCopy = true;
+				dirty.clear();
+			}
+		}
+
+		if (totViol < bestViol - FJ_FEAS_TOL || violated.empty()) {
+			if (fullCopy)
+				bestX = x;
+			else
+				for (int j : dirty)
+					bestX[j] = x[j];
+			dirty.clear();
+			fullCopy = false;
+			bestViol = totViol;
+		}
+	}
+
+	if (violated.empty())
+		A_Feasible = true;
+	A_Moves += moves;
+	A_WeightUpdates += weightUpdates;
+
+	// Recomputed from scratch: no drift of the incremental activities
+	best = evaluate(bestX);
+}
+
+Solution FeasJump::evaluate(const std::vector<double>& x) const {
+	if (x.size() < numVars)
+		throw MIPException(MIPException::ExceptionType::InputSizeError, "Wrong solution size!");
+
+	std::vector<double> act(numRows, 0.0);
+	for (size_t j{ 0 }; j < numVars; j++)
+		for (int k{ colBeg[j] }; k < colBeg[j + 1]; k++)
+			act[colRow[k]] += colVal[k] * x[j];
+
+	Solution sol{ .sol = std::vector<double>(numVars + 2 * numRows, 0.0), .slackSum = 0.0, .oMIPCost = 0.0 };
+	std::copy(x.begin(), x.begin() + numVars, sol.sol.begin());
+	for (size_t c{ 0 }; c < numRows; c++) {
+		double diff{ act[c] - rhs[c] };
+		if ((sense[c] == GE || sense[c] == EQ) && diff < 0.0)
+			sol.sol[numVars + c] = -diff;
+		if ((sense[c] == LE || sense[c] == EQ) && diff > 0.0)
+			sol.sol[numVars + numRows + c] = diff;
+		sol.slackSum += sol.sol[numVars + c] + sol.sol[numVars + numRows + c];
+	}
+	sol.oMIPCost = std::inner_product(obj.begin(), obj.end(), x.begin(), 0.0);
+	return sol;
+}
+
+std::vector<Solution> FeasJump::run(const std::vector<std::vector<double>>& starts, size_t numWalkers, double timeLimit, unsigned long long seed, bool deterministic) {
+	for (const auto& start : starts)
+		if (start.size() < numVars)
+			throw MIPException(MIPException::ExceptionType::InputSizeError, "Wrong starting vector size!");
+	if (!numWalkers || starts.empty())
+		throw MIPException(MIPException::ExceptionType::InputSizeError, "No FeasJump walkers!");
+
+	A_Feasible = false;
+	A_Moves = 0;
+	A_WeightUpdates = 0;
+
+	double startTime{ Clock::getTime() };
+	double deadline{ deterministic ? CPX_INFBOUND : startTime + timeLimit };
+	size_t maxSteps{ deterministic ? static_cast<size_t>(timeLimit * FJ_DET_STEPS_PER_SEC) : SIZE_MAX };
+
+	std::vector<Solution>	 sols(numWalkers, Solution{ .sol = {}, .slackSum = CPX_INFBOUND, .oMIPCost = CPX_INFBOUND });
+	std::vector<std::thread> walkers;
+	for (size_t i{ 0 }; i < numWalkers; i++)
+		walkers.emplace_back([this, &starts, &sols, deadline, maxSteps, seed, i]() {
+			Random rnd(seed + i + 1);
+			walk(starts[i % starts.size()], deadline, maxSteps, rnd, sols[i]);
+		});
+	for (auto& walker : walkers)
+		walker.join();
+
+	std::stable_sort(sols.begin(), sols.end(), [](const Solution& a, const Solution& b) { return a.slackSum < b.slackSum; });
+
+#if ACS_VERBOSE >= VERBOSE
+	PRINT_INFO("FeasJump - %zu walkers -- Best violation: %.6f -- Moves: %zu -- Weight updates: %zu -- Time: %.2fs", numWalkers, sols.front().slackSum, A_Moves.load(), A_WeightUpdates.load(), Clock::timeElapsed(startTime));
+#endif
+	return sols;
+}
@@ -7,7 +7,60 @@ bool isInteger(double n) {
 	return ((n < CPX_INFBOUND) && (static_cast<int>(n) == n));
 }
 
-void FixPolicy::startSolTheta(std::vector<double>& sol, std::string fileName, double theta, double timelimit, Random& rnd) {
+static std::once_flag initFlag;
+static int			  initViolConst = -1;
+
+static std::once_flag	 rootLPFlag;
+static FixPolicy::RootLP rootLP{ .x = {}, .redCosts = {}, .objValue = CPX_INFBOUND };
+
+static std::once_flag	 blocksFlag;
+static FixPolicy::Blocks blocks{ .vars = {}, .varBlock = {}, .numLinks = 0, .numComps = 0 };
+
+static double contRho{ 0.0 };
+
+/**
+ * @brief Variables the rho-fixing policies draw from: the integer ones (the continuous ones if
+ *        the MIP has no integer variables).
+ * @param model The MIP model.
+ * @return Indices of the candidate variables.
+ */
+static const std::vector<int>& fixCandidates(MIP& model) {
+	return model.getMIPIntVars().empty() ? model.getMIPContVars() : model.getMIPIntVars();
+}
+
+/**
+ * @brief Fixes a fraction contRho of the continuous variables, drawn uniformly.
+ *        Does nothing (no random draws) if contRho is 0 or they are the candidates of the policy.
+ * @param model Reference to the MIP model being modified.
+ * @param sol The solution vector.
+ * @param rnd Random number generator instance.
+ */
+static void fixContinuous(MIP& model, const std::vector<double>& sol, Random& rnd) {
+	if (contRho < EPSILON || model.getMIPIntVars().empty())
+		return;
+
+	std::vector<int> indices{ model.getMIPContVars() };
+	const size_t	 numFixedVars{ static_cast<size_t>(contRho * indices.size()) };
+	for (size_t i{ 0 }; i < numFixedVars; i++) {
+		size_t j{ static_cast<size_t>(rnd.Int(static_cast<int>(i), static_cast<int>(indices.size() - 1))) };
+		std::swap(indices[i], indices[j]);
+		model.setVarValue(indices[i], sol[indices[i]]);
+	}
+}
+
+/**
+ * @brief Sets the reference number of violated constraints of walkMIPMT from the starting vector,
+ *        so that it does not depend on which worker runs walkMIPMT first.
+ * @param model Model the starting vector has been built on.
+ * @param sol The starting vector.
+ */
+static void initWalkMIPViolConst(MIP& model, const std::vector<double>& sol) {
+	std::vector<int> violConstr;
+	model.getViolatedConstrIndex(sol, violConstr);
+	std::call_once(initFlag, [&]() { initViolConst = static_cast<int>(violConstr.size()); });
+}
+
+void FixPolicy::startSolTheta(std::vector<double>& sol, std::string fileName, double theta, double timelimit, Random& rnd, bool walkMIPRef) {
 	if (theta < EPSILON || theta > 1.0)
 		throw FixPolicyException(FPEx::InputSizeError, "Theta par. must be within (0,1)!");
 
@@ -15,61 +68,89 @@ void FixPolicy::startSolTheta(std::vector<double>& sol, std::string fileName, do
 	size_t	numVarsToFix{ relaxedFMIP.getMIPNumVars() };
 	sol.resize(numVarsToFix, CPX_INFBOUND);
 
+	std::vector<VarBounds> varRanges(numVarsToFix);
+	for (size_t i{ 0 }; i < numVarsToFix; i++)
+		varRanges[i] = relaxedFMIP.getVarBounds(i);
+
 	std::vector<size_t> varRangesIndices(numVarsToFix);
 	std::iota(varRangesIndices.begin(), varRangesIndices.end(), 0);
-	std::sort(varRangesIndices.begin(), varRangesIndices.end(), [&relaxedFMIP](const int& a, const int& b) {
-		auto [aLowerBound, aUpperBound] = relaxedFMIP.getVarBounds(a);
-		auto [bLowerBound, bUpperBound] = relaxedFMIP.getVarBounds(b);
-		return (aUpperBound - aLowerBound) < (bUpperBound - bLowerBound);
+	std::sort(varRangesIndices.begin(), varRangesIndices.end(), [&varRanges](const size_t a, const size_t b) {
+		return (varRanges[a].upperBound - varRanges[a].lowerBound) < (varRanges[b].upperBound - varRanges[b].lowerBound);
 	});
 
-	std::vector<bool> isFixed(numVarsToFix, false);
-	size_t			  numFixedVars = 0;
+	std::vector<bool>	isFixed(numVarsToFix, false);
+	size_t				numFixedVars{ 0 };
+	size_t				nextVar{ 0 }; // Entries of varRangesIndices before it are all fixed
+	std::vector<int>	fixIndices;
+	std::vector<double> fixValues;
+	fixIndices.reserve(numVarsToFix);
+	fixValues.reserve(numVarsToFix);
 
+#if ACS_VERBOSE >= VERBOSE
+	size_t numLPs{ 0 };
+	double totTicks{ 0.0 };
+#endif
+
+	// Dive: every round fixes some variables and re-optimizes the LP from the previous basis
 	while (numFixedVars < numVarsToFix) {
 
 		size_t numNotFixedVars{ numVarsToFix - numFixedVars };
 		size_t varsToFix{ static_cast<size_t>(std::ceil(numNotFixedVars * theta)) };
 
-		size_t fixedThisIteration{ 0 };
-
-		for (size_t i = 0; i < numVarsToFix && fixedThisIteration < varsToFix; i++) {
-			int idx = varRangesIndices[i];
+		fixIndices.clear();
+		fixValues.clear();
+		for (; nextVar < numVarsToFix && fixIndices.size() < varsToFix; nextVar++) {
+			size_t idx{ varRangesIndices[nextVar] };
 			if (!isFixed[idx]) {
-				auto [lowerBound, upperBound] = relaxedFMIP.getVarBounds(idx);
-
-				double clampedLower = std::max(-MAX_UB, lowerBound);
-				double clampedUpper = std::min(MAX_UB, upperBound);
+				double clampedLower = std::max(-MAX_UB, varRanges[idx].lowerBound);
+				double clampedUpper = std::min(MAX_UB, varRanges[idx].upperBound);
 
 				sol[idx] = rnd.Int(clampedLower, clampedUpper);
-				relaxedFMIP.setVarValue(idx, sol[idx]);
 				isFixed[idx] = true;
-				fixedThisIteration++;
+				fixIndices.push_back(idx);
+				fixValues.push_back(sol[idx]);
 			}
 		}
+		relaxedFMIP.setVarsValues(fixIndices, fixValues);
+		numFixedVars += fixIndices.size();
 
 #if ACS_VERBOSE >= VERBOSE
-		PRINT_INFO("FixPolicy::startSolTheta - %zu vars hard-fixed", varsToFix);
+		PRINT_INFO("FixPolicy::startSolTheta - %zu vars hard-fixed", fixIndices.size());
 #endif
+		if (numFixedVars == numVarsToFix)
+			break;
 
 		relaxedFMIP.solveRelaxation(Clock::timeRemaining(timelimit), DET_TL(relaxedFMIP.getNumNonZeros()));
+#if ACS_VERBOSE >= VERBOSE
+		numLPs++;
+		totTicks += relaxedFMIP.getLastDetTime();
+#endif
 
 		std::vector<double> lpSol = relaxedFMIP.getSol();
+		fixIndices.clear();
+		fixValues.clear();
 		for (size_t i = 0; i < numVarsToFix; ++i) {
 			if (isFixed[i])
 				continue;
 			if (isInteger(lpSol[i])) {
 				sol[i] = lpSol[i];
-				relaxedFMIP.setVarValue(i, sol[i]);
 				isFixed[i] = true;
+				fixIndices.push_back(i);
+				fixValues.push_back(sol[i]);
 			}
 		}
-
-		numFixedVars = std::accumulate(isFixed.begin(), isFixed.end(), 0);
+		relaxedFMIP.setVarsValues(fixIndices, fixValues);
+		numFixedVars += fixIndices.size();
 	}
+
+#if ACS_VERBOSE >= VERBOSE
+	PRINT_INFO("FixPolicy::startSolTheta - %zu LP solves -- Ticks: %.0f", numLPs, totTicks);
+#endif
+	if (walkMIPRef)
+		initWalkMIPViolConst(relaxedFMIP, sol);
 }
 
-void FixPolicy::startSolMaxFeas(std::vector<double>& sol, std::string fileName, Random& rnd) {
+void FixPolicy::startSolMaxFeas(std::vector<double>& sol, std::string fileName, Random& rnd, bool walkMIPRef) {
 
 	MIP	   MIP{ fileName };
 	size_t numVarsToFix{ MIP.getMIPNumVars() };
@@ -124,10 +205,44 @@ void FixPolicy::startSolMaxFeas(std::vector<double>& sol, std::string fileName,
 #if ACS_VERBOSE >= VERBOSE
 	PRINT_INFO("FixPolicy::startSolMaxFeas - %zu zeros vars | %zu vars at LB | %zu vars at UB | %zu random vars", zeros, lbs, ubs, rnds);
 #endif
+	if (walkMIPRef)
+		initWalkMIPViolConst(MIP, sol);
 }
 
-static std::once_flag initFlag;
-static int			  initViolConst = -1;
+std::vector<std::vector<double>> FixPolicy::startSolPool(std::string fileName, size_t numSols, double timeLimit, unsigned long long seed) {
+	std::vector<std::vector<double>> starts(numSols);
+	std::vector<std::thread>		 threads;
+	size_t							 numTheta{ numSols / 2 };
+	double							 diveTL{ Clock::timeElapsed() + START_POOL_TL_FRAC * timeLimit };
+
+	for (size_t i{ 0 }; i < numSols; i++) {
+		threads.emplace_back([&, i]() {
+			Random rnd(seed + i + 1);
+			// Slot 0 (always MaxFeas) alone sets the reference of walkMIPMT
+			if (i % 2 == 0 || diveTL > timeLimit) {
+				startSolMaxFeas(starts[i], fileName, rnd, i == 0);
+				return;
+			}
+
+			size_t k{ i / 2 };
+			double theta{ (numTheta > 1) ? START_POOL_MIN_THETA + (START_POOL_MAX_THETA - START_POOL_MIN_THETA) * k / (numTheta - 1) : (START_POOL_MIN_THETA + START_POOL_MAX_THETA) / 2 };
+			try {
+				startSolTheta(starts[i], fileName, theta, diveTL, rnd, false);
+			} catch (const ACSException& ex) {
+				PRINT_WARN("FixPolicy::startSolPool - startSolTheta(%.2f) failed, MaxFeas used: %s", theta, ex.what());
+				starts[i].clear();
+				startSolMaxFeas(starts[i], fileName, rnd, false);
+			}
+		});
+	}
+	for (auto& thread : threads)
+		thread.join();
+
+#if ACS_VERBOSE >= VERBOSE
+	PRINT_INFO("FixPolicy::startSolPool - %zu starting vectors (%zu MaxFeas, %zu Theta)", numSols, numSols - numTheta, numTheta);
+#endif
+	return starts;
+}
 
 void FixPolicy::walkMIPMT(const size_t threadID, const char* type, MIP& model, const std::vector<double>& sol, double rho, double p, Random& rnd) {
 	if (p < EPSILON || p >= 1.0)
@@ -138,6 +253,9 @@ void FixPolicy::walkMIPMT(const size_t threadID, const char* type, MIP& model, c
 
 	const auto& varToConstr = model.getMIPVarToConstr();
 	const auto& constrToVar = model.getMIPConstrToVar();
+	const auto& varTypes = model.getMIPVarTypes();
+	const auto& candidates = fixCandidates(model);
+	const size_t numCandidates = candidates.size();
 
 	std::vector<double> tmpSol(sol.begin(), sol.begin() + numMIPVars);
 
@@ -170,10 +288,11 @@ void FixPolicy::walkMIPMT(const size_t threadID, const char* type, MIP& model, c
 		return;
 
 	if (rnd.Double(0, 1) <= 1.0 / WALK_MIP_HUGE_KICK) {
-		for (size_t i{ 0 }; i < static_cast<size_t>(rho * numMIPVars); ++i) {
-			int varIndex = rnd.Int(0, numMIPVars - 1);
+		for (size_t i{ 0 }; i < static_cast<size_t>(rho * numCandidates); ++i) {
+			int varIndex = candidates[rnd.Int(0, numCandidates - 1)];
 			model.setVarValue(varIndex, sol[varIndex]);
 		}
+		fixContinuous(model, sol, rnd);
 
 #if ACS_VERBOSE >= VERBOSE
 		PRINT_WARN("Proc: %3d [%s] - FixPolicy::walkMIPMT - Applying WalkMIP_Huge_Kick", threadID, type);
@@ -196,7 +315,7 @@ void FixPolicy::walkMIPMT(const size_t threadID, const char* type, MIP& model, c
 
 		for (int varIndex : constrToVar[rndConstrInd]) {
 
-			switch (model.getVarType(varIndex)) {
+			switch (varTypes[varIndex]) {
 				case CPX_BINARY: {
 					int tmpBin = not tmpSol[varIndex];
 					perturb = tmpBin - tmpSol[varIndex];
@@ -262,7 +381,7 @@ void FixPolicy::walkMIPMT(const size_t threadID, const char* type, MIP& model, c
 				minDMGMoves++;
 #endif
 			} else {
-				int rndVar = rnd.Int(0, numMIPVars - 1);
+				int rndVar = candidates[rnd.Int(0, numCandidates - 1)];
 				model.setVarValue(rndVar, tmpSol[rndVar]);
 #if ACS_VERBOSE >= VERBOSE
 				rndMoves++;
@@ -280,18 +399,19 @@ void FixPolicy::walkMIPMT(const size_t threadID, const char* type, MIP& model, c
 			   threadID, type, numViolatedConstr, violConstr.size(), bestMoves, minDMGMoves, rndMoves);
 #endif
 
-	if (numVarToFix < static_cast<size_t>(rho * numMIPVars)) {
-		size_t		 remVar = static_cast<size_t>(rho * numMIPVars) - numVarToFix;
-		const size_t start = rnd.Int(0, numMIPVars - 1);
+	if (numVarToFix < static_cast<size_t>(rho * numCandidates)) {
+		size_t		 remVar = static_cast<size_t>(rho * numCandidates) - numVarToFix;
+		const size_t start = rnd.Int(0, numCandidates - 1);
 
 		for (size_t i{ 0 }; i < remVar; i++) {
-			size_t index{ (start + i) % numMIPVars };
+			int index{ candidates[(start + i) % numCandidates] };
 			model.setVarValue(index, sol[index]);
 		}
 #if ACS_VERBOSE >= VERBOSE
 		PRINT_INFO("Proc: %3d [%s] - FixPolicy::walkMIPMT - %zu vars hard-fixed [%5.4f]", threadID, type, remVar, rho);
 #endif
 	}
+	fixContinuous(model, sol, rnd);
 }
 
 void FixPolicy::fixSlackUpperBoundMT(const size_t threadID, const char* type, MIP& model, const std::vector<double>& sol) {
@@ -344,122 +464,473 @@ void FixPolicy::randomRhoFixMT(const size_t threadID, const char* type, MIP& mod
 	if (rho < EPSILON || rho >= 1.0)
 		throw FixPolicyException(FPEx::InputSizeError, "Rho par. must be within (0,1)!");
 
-	size_t		 xLen{ model.getMIPNumVars() };
-	const size_t numFixedVars = static_cast<size_t>(rho * xLen);
-	const size_t start = rnd.Int(0, xLen - 1);
+	const std::vector<int>& candidates{ fixCandidates(model) };
+	size_t					xLen{ candidates.size() };
+	const size_t			numFixedVars = static_cast<size_t>(rho * xLen);
+	const size_t			start = rnd.Int(0, xLen - 1);
 
 #if ACS_VERBOSE >= VERBOSE
 	PRINT_INFO("Proc: %3d [%s] - FixPolicy::randomRhoFixMT - %zu vars hard-fixed [%5.4f]", threadID, type, numFixedVars, rho);
 #endif
 
 	for (size_t i{ 0 }; i < numFixedVars; i++) {
-		size_t index{ (start + i) % xLen };
+		int index{ candidates[(start + i) % xLen] };
 		model.setVarValue(index, sol[index]);
 	}
+	fixContinuous(model, sol, rnd);
 }
 
-void FixPolicy::dynamicAdjustRho(const char* phase, const int solveCode, const size_t numMIPs, double& CLIRho, const size_t A_RhoChanges) {
-	if (A_RhoChanges >= numMIPs)
-		return;
+void FixPolicy::uniformRhoFixMT(const size_t threadID, const char* type, MIP& model, const std::vector<double>& sol, double rho, Random& rnd) {
+	if (rho < EPSILON || rho >= 1.0)
+		throw FixPolicyException(FPEx::InputSizeError, "Rho par. must be within (0,1)!");
 
-	double scaledDeltaRho = 2 * DELTA_RHO / numMIPs;
+	std::vector<int> indices{ fixCandidates(model) };
+	size_t			 xLen{ indices.size() };
+	const size_t	 numFixedVars = static_cast<size_t>(rho * xLen);
 
-	switch (solveCode) {
-		case CPXMIP_OPTIMAL:
-		case CPXMIP_OPTIMAL_TOL:
-			CLIRho = (CLIRho - scaledDeltaRho < MIN_RHO) ? MIN_RHO : CLIRho - scaledDeltaRho;
 #if ACS_VERBOSE >= VERBOSE
-			PRINT_INFO("[%s] - FixPolicy::dynamicAdjustRho - Rho Decreased [%5.4f]", phase, CLIRho);
+	PRINT_INFO("Proc: %3d [%s] - FixPolicy::uniformRhoFixMT - %zu vars hard-fixed [%5.4f]", threadID, type, numFixedVars, rho);
 #endif
-			break;
 
-		case CPXMIP_DETTIME_LIM_FEAS:
-		case CPXMIP_TIME_LIM_FEAS:
-			CLIRho = (CLIRho + scaledDeltaRho > MAX_RHO) ? MAX_RHO : CLIRho + scaledDeltaRho;
+	// Partial Fisher-Yates shuffle: the first numFixedVars entries are the sample
+	for (size_t i{ 0 }; i < numFixedVars; i++) {
+		size_t j{ static_cast<size_t>(rnd.Int(static_cast<int>(i), static_cast<int>(xLen - 1))) };
+		std::swap(indices[i], indices[j]);
+		model.setVarValue(indices[i], sol[indices[i]]);
+	}
+	fixContinuous(model, sol, rnd);
+}
+
+/**
+ * @brief Seeds of the graph neighborhoods: variables of the constraints violated by sol or,
+ *        if sol is feasible, variables whose value changed since prevSol.
+ *
+ * @param model The MIP model.
+ * @param sol The solution vector.
+ * @param prevSol Previous reference solution (may be empty).
+ * @param numMIPVars Number of MIP variables.
+ * @return Seed variables (empty if none).
+ */
+static std::vector<int> graphSeeds(MIP& model, const std::vector<double>& sol, const std::vector<double>& prevSol, size_t numMIPVars) {
+	std::vector<int> seeds;
+	std::vector<int> violConstr;
+	model.getViolatedConstrIndex(std::vector<double>(sol.begin(), sol.begin() + numMIPVars), violConstr);
+
+	if (!violConstr.empty()) {
+		std::vector<char> seen(numMIPVars, 0);
+		for (int c : violConstr)
+			for (int v : model.getMIPConstrToVar()[c])
+				if (!seen[v]) {
+					seen[v] = 1;
+					seeds.push_back(v);
+				}
+		return seeds;
+	}
+
+	if (prevSol.size() >= numMIPVars)
+		for (size_t i{ 0 }; i < numMIPVars; i++)
+			if (std::abs(sol[i] - prevSol[i]) >= EPSILON)
+				seeds.push_back(static_cast<int>(i));
+	return seeds;
+}
+
+/**
+ * @brief Picks a variable not free yet: a seed if any is left, a random variable otherwise.
+ *
+ * @param seeds Seed variables.
+ * @param free Free flags.
+ * @param rnd Random number generator instance.
+ * @return Index of the variable.
+ */
+static int graphRestart(const std::vector<int>& seeds, const std::vector<char>& free, Random& rnd) {
+	for (int tries{ 0 }; !seeds.empty() && tries < GRAPH_WALK_MAX_STUCK; tries++) {
+		int v{ seeds[rnd.Int(0, seeds.size() - 1)] };
+		if (!free[v])
+			return v;
+	}
+
+	int v;
+	do
+		v = rnd.Int(0, free.size() - 1);
+	while (free[v]);
+	return v;
+}
+
+/**
+ * @brief Grows a connected free set on the variable-constraint graph and fixes the other variables.
+ *
+ * @param threadID ID of the thread executing this function.
+ * @param type Type of subMIP applied.
+ * @param model Reference to the MIP model being modified.
+ * @param sol The solution vector.
+ * @param prevSol Previous reference solution (may be empty).
+ * @param rho Rho parameter value.
+ * @param walk True for random walks, false for BFS.
+ * @param rnd Random number generator instance.
+ */
+static void graphFix(const size_t threadID, const char* type, MIP& model, const std::vector<double>& sol, const std::vector<double>& prevSol, double rho, bool walk, Random& rnd) {
+	if (rho < EPSILON || rho >= 1.0)
+		throw FixPolicy::FixPolicyException(FPEx::InputSizeError, "Rho par. must be within (0,1)!");
+
+	const size_t			numMIPVars{ model.getMIPNumVars() };
+	const std::vector<int>& candidates{ fixCandidates(model) };
+	const size_t			numFree{ candidates.size() - static_cast<size_t>(rho * candidates.size()) };
+	const auto&				varToConstr{ model.getMIPVarToConstr() };
+	const auto&				constrToVar{ model.getMIPConstrToVar() };
+
+	std::vector<int>  seeds{ graphSeeds(model, sol, prevSol, numMIPVars) };
+	std::vector<char> free(numMIPVars, 0);
+	std::vector<char> isCandidate(numMIPVars, 0);
+	size_t			  numFreed{ 0 };
+	size_t			  numRestarts{ 0 };
+	for (int v : candidates)
+		isCandidate[v] = 1;
+
+	// Only the candidates count towards numFree: the other variables are crossed but never fixed
+	auto setFree = [&](int v) {
+		if (free[v] || numFreed >= numFree)
+			return false;
+		free[v] = 1;
+		numFreed += isCandidate[v];
+		return true;
+	};
+
+	if (walk) {
+		int	   cur{ graphRestart(seeds, free, rnd) };
+		size_t stuck{ 0 };
+		setFree(cur);
+		while (numFreed < numFree) {
+			if (varToConstr[cur].empty() || stuck >= GRAPH_WALK_MAX_STUCK) {
+				cur = graphRestart(seeds, free, rnd);
+				setFree(cur);
+				stuck = 0;
+				numRestarts++;
+				continue;
+			}
+			const std::vector<int>& rowVars{ constrToVar[varToConstr[cur][rnd.Int(0, varToConstr[cur].size() - 1)]] };
+			cur = rowVars[rnd.Int(0, rowVars.size() - 1)];
+			stuck = setFree(cur) ? 0 : stuck + 1;
+		}
+	} else {
+		std::vector<char> rowSeen(constrToVar.size(), 0);
+		std::vector<int>  queue;
+		queue.reserve(numFree);
+
+		size_t head{ 0 };
+		while (numFreed < numFree) {
+			if (head == queue.size()) {
+				int v{ graphRestart(seeds, free, rnd) };
+				setFree(v);
+				queue.push_back(v);
+				numRestarts++;
+			}
+			int v{ queue[head++] };
+			for (int c : varToConstr[v]) {
+				if (rowSeen[c])
+					continue;
+				rowSeen[c] = 1;
+				for (int u : constrToVar[c])
+					if (setFree(u))
+						queue.push_back(u);
+				if (numFreed >= numFree)
+					break;
+			}
+		}
+	}
+
+	for (int v : candidates)
+		if (!free[v])
+			model.setVarValue(v, sol[v]);
+	fixContinuous(model, sol, rnd);
+
 #if ACS_VERBOSE >= VERBOSE
-			PRINT_INFO("[%s] - FixPolicy::dynamicAdjustRho - Rho Increased [%5.4f]", phase, CLIRho);
+	PRINT_INFO("Proc: %3d [%s] - FixPolicy::graph%sFixMT - %zu vars hard-fixed [%5.4f] -- Seeds: %zu -- Restarts: %zu", threadID, type, walk ? "Walk" : "BFS", candidates.size() - numFreed, rho, seeds.size(), numRestarts);
 #endif
-			break;
+}
 
-		default:
+void FixPolicy::graphBFSFixMT(const size_t threadID, const char* type, MIP& model, const std::vector<double>& sol, const std::vector<double>& prevSol, double rho, Random& rnd) {
+	graphFix(threadID, type, model, sol, prevSol, rho, false, rnd);
+}
+
+void FixPolicy::graphWalkFixMT(const size_t threadID, const char* type, MIP& model, const std::vector<double>& sol, const std::vector<double>& prevSol, double rho, Random& rnd) {
+	graphFix(threadID, type, model, sol, prevSol, rho, true, rnd);
+}
+
+void FixPolicy::solveRootLP(std::string fileName, double timeLimit) {
+	std::call_once(rootLPFlag, [&]() {
+		if (timeLimit < EPSILON)
+			return;
+
+		MIP	   rootMIP{ fileName };
+		size_t numMIPVars{ rootMIP.getMIPNumVars() };
 #if ACS_VERBOSE >= VERBOSE
-			PRINT_ERR("Unexpected value for solvecode: %d", solveCode);
+		double startTime{ Clock::getTime() };
 #endif
+		int solveCode{ rootMIP.solveLP(timeLimit) };
 
-			break;
-	}
+		if (solveCode != CPX_STAT_OPTIMAL) {
+			PRINT_WARN("FixPolicy::solveRootLP - Root LP not solved to optimality (code %d): LP-guided fixing disabled", solveCode);
+			return;
+		}
+
+		rootLP.x = rootMIP.getSol();
+		rootLP.redCosts = rootMIP.getReducedCosts();
+		rootLP.x.resize(numMIPVars);
+		rootLP.redCosts.resize(numMIPVars);
+		rootLP.objValue = rootMIP.getObjValue();
+
+#if ACS_VERBOSE >= VERBOSE
+		PRINT_INFO("FixPolicy::solveRootLP - Root LP value: %20.2f -- Time: %.2fs -- Ticks: %.0f", rootLP.objValue, Clock::timeElapsed(startTime), rootMIP.getLastDetTime());
+#endif
+	});
 }
 
-static std::atomic<size_t> numDecRho{ 0 };
-static std::atomic<size_t> numIncRho{ 0 };
-static std::mutex		   rhoMutex;
-static std::once_flag	   resetFlag;
+const FixPolicy::RootLP& FixPolicy::getRootLP() {
+	return rootLP;
+}
 
-void FixPolicy::dynamicAdjustRhoMT(const size_t threadID, const char* type, const int solveCode, const size_t numMIPs, double& CLIRho, std::atomic_size_t& A_RhoChanges) {
+void FixPolicy::rinsFixMT(const size_t threadID, const char* type, MIP& model, const std::vector<double>& sol, double rho, Random& rnd) {
+	if (rho < EPSILON || rho >= 1.0)
+		throw FixPolicyException(FPEx::InputSizeError, "Rho par. must be within (0,1)!");
 
-	if (A_RhoChanges.load() >= numMIPs)
-		return;
+	const std::vector<double>& lpSol{ rootLP.x };
+	const std::vector<int>&	   candidates{ fixCandidates(model) };
+	const size_t			   numFixedVars{ static_cast<size_t>(rho * candidates.size()) };
+	if (lpSol.size() != model.getMIPNumVars())
+		throw FixPolicyException(FPEx::InputSizeError, "Root LP not available!");
+
+	// Agreeing variables first (in random order), then the others by distance from the LP value
+	std::vector<size_t> agree, disagree;
+	agree.reserve(candidates.size());
+	for (size_t i : candidates) {
+		if (std::abs(sol[i] - lpSol[i]) <= MIP_INT_TOL)
+			agree.push_back(i);
+		else
+			disagree.push_back(i);
+	}
 
-	// Reset counters once when first thread reaches here
-	if (A_RhoChanges.load() == 0) {
-		std::call_once(resetFlag, []() {
-			numDecRho.store(0);
-			numIncRho.store(0);
+	size_t numFromAgree{ std::min(numFixedVars, agree.size()) };
+	for (size_t i{ 0 }; i < numFromAgree; i++) {
+		size_t j{ static_cast<size_t>(rnd.Int(static_cast<int>(i), static_cast<int>(agree.size() - 1))) };
+		std::swap(agree[i], agree[j]);
+		model.setVarValue(agree[i], sol[agree[i]]);
+	}
+
+	size_t numFromDisagree{ numFixedVars - numFromAgree };
+	if (numFromDisagree) {
+		std::nth_element(disagree.begin(), disagree.begin() + numFromDisagree - 1, disagree.end(), [&](size_t a, size_t b) {
+			return std::abs(sol[a] - lpSol[a]) < std::abs(sol[b] - lpSol[b]);
 		});
+		for (size_t i{ 0 }; i < numFromDisagree; i++)
+			model.setVarValue(disagree[i], sol[disagree[i]]);
 	}
+	fixContinuous(model, sol, rnd);
 
-	double scaledDeltaRho = DELTA_RHO / numMIPs;
+#if ACS_VERBOSE >= VERBOSE
+	PRINT_INFO("Proc: %3d [%s] - FixPolicy::rinsFixMT - %zu vars hard-fixed [%5.4f] -- Agreeing with LP: %zu", threadID, type, numFixedVars, rho, agree.size());
+#endif
+}
 
-	// Use mutex only for CLIRho modifications
-	switch (solveCode) {
-		case CPXMIP_OPTIMAL:
-		case CPXMIP_OPTIMAL_TOL: {
-			std::lock_guard<std::mutex> lock(rhoMutex);
-			if (A_RhoChanges.load() >= numMIPs)
-				return; // Double-check
+void FixPolicy::redCostFixMT(const size_t threadID, const char* type, MIP& model, const std::vector<double>& sol, double rho, Random& rnd) {
+	if (rho < EPSILON || rho >= 1.0)
+		throw FixPolicyException(FPEx::InputSizeError, "Rho par. must be within (0,1)!");
+
+	const std::vector<double>& redCosts{ rootLP.redCosts };
+	const size_t			   xLen{ model.getMIPNumVars() };
+	std::vector<int>		   indices{ fixCandidates(model) };
+	const size_t			   numFixedVars{ static_cast<size_t>(rho * indices.size()) };
+	if (redCosts.size() != xLen)
+		throw FixPolicyException(FPEx::InputSizeError, "Root LP not available!");
+
+	if (numFixedVars) {
+		// Basic variables (zero reduced cost) get a tiny random key: they are fixed last, in random order
+		std::vector<double> key(xLen);
+		for (int i : indices)
+			key[i] = (std::abs(redCosts[i]) + EPSILON) * (1.0 - REDCOST_NOISE * rnd.Double(0.0, 1.0));
+
+		std::nth_element(indices.begin(), indices.begin() + numFixedVars - 1, indices.end(), [&key](int a, int b) { return key[a] > key[b]; });
+		for (size_t i{ 0 }; i < numFixedVars; i++)
+			model.setVarValue(indices[i], sol[indices[i]]);
+	}
+	fixContinuous(model, sol, rnd);
 
-			CLIRho = (CLIRho - scaledDeltaRho < MIN_RHO) ? MIN_RHO : CLIRho - scaledDeltaRho;
-			A_RhoChanges.fetch_add(1);
-			numDecRho.fetch_add(1);
 #if ACS_VERBOSE >= VERBOSE
-			PRINT_INFO("Proc: %3d [%s] - FixPolicy::dynamicAdjustRhoMT - Rho Decreased [%5.4f]",
-					   threadID, type, CLIRho);
+	PRINT_INFO("Proc: %3d [%s] - FixPolicy::redCostFixMT - %zu vars hard-fixed [%5.4f]", threadID, type, numFixedVars, rho);
 #endif
-			break;
+}
+
+void FixPolicy::detectBlocks(std::string fileName) {
+	std::call_once(blocksFlag, [&]() {
+		MIP			 mip{ fileName };
+		const size_t numMIPVars{ mip.getMIPNumVars() };
+		const auto&	 constrToVar{ mip.getMIPConstrToVar() };
+		const size_t numRows{ constrToVar.size() };
+		if (!numRows || numMIPVars < 2)
+			return;
+
+		// Linking rows: the longest ones, well above the mean row length
+		size_t nnz{ 0 };
+		for (const auto& row : constrToVar)
+			nnz += row.size();
+		const double		linkLen{ BLOCK_LINK_FACTOR * static_cast<double>(nnz) / numRows };
+		const size_t		maxLinks{ static_cast<size_t>(BLOCK_MAX_LINK_FRAC * numRows) };
+		std::vector<size_t> rows(numRows);
+		std::iota(rows.begin(), rows.end(), 0);
+		std::stable_sort(rows.begin(), rows.end(), [&constrToVar](size_t a, size_t b) { return constrToVar[a].size() > constrToVar[b].size(); });
+
+		std::vector<char> isLink(numRows, 0);
+		for (size_t k{ 0 }; k < maxLinks && constrToVar[rows[k]].size() > linkLen; k++) {
+			isLink[rows[k]] = 1;
+			blocks.numLinks++;
+		}
+
+		// Union-find over the variables sharing a non-linking row
+		std::vector<int> parent(numMIPVars);
+		std::iota(parent.begin(), parent.end(), 0);
+		auto find = [&parent](int v) {
+			while (parent[v] != v) {
+				parent[v] = parent[parent[v]];
+				v = parent[v];
+			}
+			return v;
+		};
+		for (size_t r{ 0 }; r < numRows; r++) {
+			if (isLink[r] || constrToVar[r].empty())
+				continue;
+			int root{ find(constrToVar[r].front()) };
+			for (int v : constrToVar[r]) {
+				int vRoot{ find(v) };
+				if (vRoot != root)
+					parent[vRoot] = root;
+			}
+		}
+
+		std::vector<int>			  compOf(numMIPVars, -1);
+		std::vector<std::vector<int>> comps;
+		for (size_t v{ 0 }; v < numMIPVars; v++) {
+			int root{ find(static_cast<int>(v)) };
+			if (compOf[root] < 0) {
+				compOf[root] = static_cast<int>(comps.size());
+				comps.emplace_back();
+			}
+			comps[compOf[root]].push_back(static_cast<int>(v));
+		}
+		blocks.numComps = comps.size();
+
+		const size_t numBlocks{ std::min<size_t>(comps.size(), BLOCK_MAX_BLOCKS) };
+		if (numBlocks < 2) {
+#if ACS_VERBOSE >= VERBOSE
+			PRINT_INFO("FixPolicy::detectBlocks - No block structure (%zu linking rows removed)", blocks.numLinks);
+#endif
+			return;
 		}
 
-		case CPXMIP_DETTIME_LIM_FEAS:
-		case CPXMIP_TIME_LIM_FEAS: {
-			std::lock_guard<std::mutex> lock(rhoMutex);
-			if (A_RhoChanges.load() >= numMIPs)
-				return; // Double-check
+		// Largest components first, each into the smallest block so far
+		std::stable_sort(comps.begin(), comps.end(), [](const std::vector<int>& a, const std::vector<int>& b) { return a.size() > b.size(); });
+		std::vector<std::vector<int>> packed(numBlocks);
+		for (const auto& comp : comps) {
+			auto& block{ *std::min_element(packed.begin(), packed.end(), [](const std::vector<int>& a, const std::vector<int>& b) { return a.size() < b.size(); }) };
+			block.insert(block.end(), comp.begin(), comp.end());
+		}
 
-			CLIRho = (CLIRho + scaledDeltaRho > MAX_RHO) ? MAX_RHO : CLIRho + scaledDeltaRho;
-			A_RhoChanges.fetch_add(1);
-			numIncRho.fetch_add(1);
+		size_t largest{ 0 };
+		for (auto& block : packed) {
+			std::sort(block.begin(), block.end());
+			largest = std::max(largest, block.size());
+		}
+		if (largest > BLOCK_MAX_SHARE * numMIPVars) {
 #if ACS_VERBOSE >= VERBOSE
-			PRINT_INFO("Proc: %3d [%s] - FixPolicy::dynamicAdjustRhoMT - Rho Increased [%5.4f]",
-					   threadID, type, CLIRho);
+			PRINT_INFO("FixPolicy::detectBlocks - No block structure (largest block: %zu of %zu vars)", largest, numMIPVars);
 #endif
-			break;
+			return;
 		}
 
-		default:
+		blocks.varBlock.assign(numMIPVars, 0);
+		for (size_t b{ 0 }; b < packed.size(); b++)
+			for (int v : packed[b])
+				blocks.varBlock[v] = static_cast<int>(b);
+		blocks.vars = std::move(packed);
+
 #if ACS_VERBOSE >= VERBOSE
-			PRINT_ERR("Unexpected value for solvecode: %d", solveCode);
+		PRINT_INFO("FixPolicy::detectBlocks - %zu blocks (%zu components) -- Linking rows: %zu -- Largest block: %zu vars", blocks.vars.size(), blocks.numComps, blocks.numLinks, largest);
 #endif
-			break;
+	});
+}
+
+const FixPolicy::Blocks& FixPolicy::getBlocks() {
+	return blocks;
+}
+
+void FixPolicy::blockFixMT(const size_t threadID, const char* type, MIP& model, const std::vector<double>& sol, size_t block, double rho, Random& rnd) {
+	if (rho < EPSILON || rho >= 1.0)
+		throw FixPolicyException(FPEx::InputSizeError, "Rho par. must be within (0,1)!");
+	if (block >= blocks.vars.size())
+		throw FixPolicyException(FPEx::InputSizeError, "Block not available!");
+
+	const std::vector<int>& candidates{ fixCandidates(model) };
+	const size_t			maxFree{ candidates.size() - static_cast<size_t>(rho * candidates.size()) };
+
+	std::vector<int> blockVars;
+	for (int v : candidates) {
+		if (blocks.varBlock[v] == static_cast<int>(block))
+			blockVars.push_back(v);
+		else
+			model.setVarValue(v, sol[v]);
 	}
 
-	// Coinflip case handling (also needs mutex for CLIRho access)
-	{
-		std::lock_guard<std::mutex> lock(rhoMutex);
-		size_t						currentChanges = A_RhoChanges.load();
-		if (currentChanges == numMIPs && numIncRho.load() == numDecRho.load()) {
-			CLIRho = (CLIRho - DELTA_RHO < MIN_RHO) ? MIN_RHO : CLIRho - DELTA_RHO;
+	// A block larger than the rho neighborhood is cut down by a window
+	size_t numWindow{ 0 };
+	if (blockVars.size() > maxFree) {
+		numWindow = blockVars.size() - maxFree;
+		const size_t start = rnd.Int(0, blockVars.size() - 1);
+		for (size_t i{ 0 }; i < numWindow; i++) {
+			int index{ blockVars[(start + i) % blockVars.size()] };
+			model.setVarValue(index, sol[index]);
+		}
+	}
+	fixContinuous(model, sol, rnd);
+
 #if ACS_VERBOSE >= VERBOSE
-			PRINT_WARN("[\"COINFLIP\" CASE] - FixPolicy::dynamicAdjustRhoMT - Rho decreased [%5.4f]", CLIRho);
+	PRINT_INFO("Proc: %3d [%s] - FixPolicy::blockFixMT - Block %zu: %zu vars free [%5.4f]", threadID, type, block, blockVars.size() - numWindow, rho);
 #endif
-		}
+}
+
+void FixPolicy::localBranchMT(const size_t threadID, const char* type, MIP& model, const std::vector<double>& sol, double rho, Random& rnd) {
+	if (rho < EPSILON || rho >= 1.0)
+		throw FixPolicyException(FPEx::InputSizeError, "Rho par. must be within (0,1)!");
+
+	// sum_{x_j = 0} x_j + sum_{x_j = 1} (1 - x_j) <= k
+	const auto&			varTypes{ model.getMIPVarTypes() };
+	std::vector<int>	indices;
+	std::vector<double> values;
+	double				rhs{ 0.0 };
+	for (int v : model.getMIPIntVars()) {
+		if (varTypes[v] != CPX_BINARY)
+			continue;
+		indices.push_back(v);
+		if (sol[v] > 0.5) {
+			values.push_back(-1.0);
+			rhs -= 1.0;
+		} else
+			values.push_back(1.0);
+	}
+
+	if (indices.empty()) {
+		randomRhoFixMT(threadID, type, model, sol, rho, rnd);
+		return;
 	}
-}
\ No newline at end of file
+
+	const double k{ std::max<double>(LOCAL_BRANCH_MIN_K, std::round(LOCAL_BRANCH_K_FRAC * (1.0 - rho) * indices.size())) };
+	model.addRow(indices, values, LOCAL_BRANCH_SENSE, rhs + k);
+	fixContinuous(model, sol, rnd);
+
+#if ACS_VERBOSE >= VERBOSE
+	PRINT_INFO("Proc: %3d [%s] - FixPolicy::localBranchMT - Radius %.0f on %zu binaries [%5.4f]", threadID, type, k, indices.size(), rho);
+#endif
+}
+
+void FixPolicy::setContinuousRho(double rho) {
+	if (rho < 0.0 || rho >= 1.0)
+		throw FixPolicyException(FPEx::InputSizeError, "Continuous rho par. must be within [0,1)!");
+	contRho = rho;
+}
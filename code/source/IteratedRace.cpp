@@ -0,0 +1,407 @@
+#include "../include/IteratedRace.hpp"
+
+#include <atomic>
+#include <limits>
+
+using ACSEx = ACSException::ExceptionType;
+
+IteratedRace::IteratedRace(std::vector<Param> space, std::vector<Instance> instances, size_t budget, size_t numWorkers, unsigned long long seed, Evaluator evaluator)
+	: space{ std::move(space) }, instances{ std::move(instances) }, budget{ budget }, numWorkers{ std::max<size_t>(1, numWorkers) }, evaluator{ std::move(evaluator) }, rnd{ seed }, sdFactor{ RACE_SD_INIT } {
+	if (this->space.empty() || this->instances.empty())
+		throw RaceException(ACSEx::InputSizeError, "Empty parameter space or instance list");
+
+	numIterations = 2 + static_cast<size_t>(std::log2(static_cast<double>(this->space.size())));
+	minSurvivors = numIterations;
+
+	if (budget < RACE_MIN_CONFIGS * RACE_FIRST_TEST)
+		throw RaceException(ACSEx::WrongArgsValue, "Budget too small: at least " + std::to_string(RACE_MIN_CONFIGS * RACE_FIRST_TEST) + " runs are needed");
+}
+
+const IteratedRace::Config& IteratedRace::run() {
+	size_t used{ 0 };
+
+	// Iterations past numIterations spend the budget the races left
+	for (size_t it{ 0 }; budget - used >= RACE_MIN_CONFIGS * RACE_FIRST_TEST; it++) {
+		// Budget of the iteration and number of configurations it can race
+		size_t itBudget{ (budget - used) / (numIterations - std::min(it, numIterations - 1)) };
+		size_t numConfigs{ std::max<size_t>(RACE_MIN_CONFIGS, itBudget / (RACE_FIRST_TEST + std::min<size_t>(5, it) * RACE_EACH_TEST)) };
+
+		std::vector<size_t> alive{ elites };
+		if (it)
+			sdFactor *= std::pow(1.0 / std::max<size_t>(1, numConfigs - std::min(numConfigs, elites.size())), 1.0 / space.size());
+		while (alive.size() < numConfigs)
+			alive.push_back(sample(it));
+
+		PRINT_OUT("Race %zu/%zu -- Budget: %zu runs -- Configurations: %zu (elites: %zu)", it + 1, numIterations, itBudget, alive.size(), elites.size());
+		std::vector<size_t> visited;
+		size_t				raceRuns{ race(it, alive, itBudget, visited) };
+		used += raceRuns;
+		if (!raceRuns)
+			break;
+
+		// Elites: best rank sums over the blocks of the race (every survivor has run them all)
+		double				sumSq{ 0.0 };
+		std::vector<double> sums{ rankSums(alive, visited, sumSq) };
+		std::vector<size_t> order(alive.size());
+		std::iota(order.begin(), order.end(), 0);
+		std::stable_sort(order.begin(), order.end(), [&](size_t a, size_t b) { return sums[a] < sums[b]; });
+
+		elites.clear();
+		for (size_t i{ 0 }; i < order.size() && elites.size() < minSurvivors; i++)
+			elites.push_back(alive[order[i]]);
+
+		PRINT_OUT("Race %zu/%zu -- Runs used: %zu/%zu -- Best: #%zu (mean score %.6f on %zu blocks)", it + 1, numIterations, used, budget, elites.front(), meanScore(elites.front()), numRuns(elites.front()));
+	}
+
+	if (elites.empty())
+		throw RaceException(ACSEx::WrongArgsValue, "Budget too small: no race completed");
+	return configs[elites.front()];
+}
+
+double IteratedRace::meanScore(size_t config) const {
+	double sum{ 0.0 };
+	size_t count{ 0 };
+	for (auto it{ cache.lower_bound({ config, 0 }) }; it != cache.end() && it->first.first == config; ++it, count++)
+		sum += runs[it->second].result.score;
+	return count ? sum / count : std::numeric_limits<double>::quiet_NaN();
+}
+
+size_t IteratedRace::numRuns(size_t config) const {
+	size_t count{ 0 };
+	for (auto it{ cache.lower_bound({ config, 0 }) }; it != cache.end() && it->first.first == config; ++it)
+		count++;
+	return count;
+}
+
+const IteratedRace::Block& IteratedRace::block(size_t index) {
+	while (blocks.size() <= index) {
+		if (instOrder.empty()) {
+			instOrder.resize(instances.size());
+			std::iota(instOrder.begin(), instOrder.end(), 0);
+			for (size_t i{ instOrder.size() - 1 }; i > 0; i--)
+				std::swap(instOrder[i], instOrder[rnd.Int(0, static_cast<int>(i))]);
+		}
+		blocks.push_back({ .instance = instOrder.back(), .seed = static_cast<unsigned long long>(rnd.Int(1, INT_MAX)) });
+		instOrder.pop_back();
+	}
+	return blocks[index];
+}
+
+size_t IteratedRace::sample(size_t iteration) {
+	Config config{ .id = configs.size(), .parent = configs.size(), .iteration = iteration, .values = std::vector<double>(space.size()) };
+
+	if (elites.empty()) {
+		for (size_t p{ 0 }; p < space.size(); p++) {
+			const Param& param{ space[p] };
+			if (param.type == 'c')
+				config.values[p] = param.values[rnd.Int(0, static_cast<int>(param.values.size()) - 1)];
+			else if (param.type == 'i')
+				config.values[p] = rnd.Int(static_cast<int>(param.values[0]), static_cast<int>(param.values[1]));
+			else
+				config.values[p] = rnd.Double(param.values[0], param.values[1]);
+		}
+	} else {
+		// Parent drawn with weight (numElites - rank)
+		size_t numElites{ elites.size() };
+		int	   draw{ rnd.Int(0, static_cast<int>(numElites * (numElites + 1) / 2) - 1) };
+		size_t rank{ 0 };
+		while (draw >= static_cast<int>(numElites - rank)) {
+			draw -= static_cast<int>(numElites - rank);
+			rank++;
+		}
+		const Config& parent{ configs[elites[rank]] };
+		config.parent = parent.id;
+
+		// Categorical values stay with the parent more and more often along the iterations
+		double keepProb{ static_cast<double>(iteration) / numIterations };
+		for (size_t p{ 0 }; p < space.size(); p++) {
+			const Param& param{ space[p] };
+			if (param.type == 'c') {
+				config.values[p] = (rnd.Double(0.0, 1.0) < keepProb) ? parent.values[p] : param.values[rnd.Int(0, static_cast<int>(param.values.size()) - 1)];
+				continue;
+			}
+
+			double lo{ param.values[0] }, hi{ param.values[1] };
+			double sd{ sdFactor * (hi - lo) };
+			double value{ parent.values[p] };
+			for (size_t t{ 0 }; t < RACE_SAMPLE_TRIES; t++) {
+				// Box-Muller normal draw around the parent value
+				double u1{ 1.0 - rnd.Double(0.0, 1.0) }, u2{ rnd.Double(0.0, 1.0) };
+				value = parent.values[p] + sd * std::sqrt(-2.0 * std::log(u1)) * std::cos(2.0 * M_PI * u2);
+				if (value >= lo && value <= hi)
+					break;
+			}
+			value = std::clamp(value, lo, hi);
+			config.values[p] = (param.type == 'i') ? std::round(value) : value;
+		}
+	}
+
+	configs.push_back(std::move(config));
+	return configs.back().id;
+}
+
+size_t IteratedRace::evaluate(const std::vector<size_t>& alive, size_t blockIdx) {
+	const Block&		b{ block(blockIdx) };
+	std::vector<size_t> todo;
+	for (size_t c : alive)
+		if (!cache.contains({ c, blockIdx }))
+			todo.push_back(c);
+
+	std::vector<Result> results(todo.size());
+	std::atomic<size_t> next{ 0 };
+	auto				worker = [&]() {
+		   for (size_t i{ next++ }; i < todo.size(); i = next++)
+			   results[i] = evaluator(configs[todo[i]], instances[b.instance], b.seed);
+	};
+
+	std::vector<std::thread> threads;
+	for (size_t w{ 0 }; w < std::min(numWorkers, todo.size()); w++)
+		threads.emplace_back(worker);
+	for (auto& th : threads)
+		th.join();
+
+	for (size_t i{ 0 }; i < todo.size(); i++) {
+		cache[{ todo[i], blockIdx }] = runs.size();
+		runs.push_back({ .config = todo[i], .block = blockIdx, .result = results[i] });
+	}
+	return todo.size();
+}
+
+size_t IteratedRace::race(size_t iteration, std::vector<size_t>& alive, size_t raceBudget, std::vector<size_t>& visited) {
+	size_t used{ 0 };
+	size_t seen{ blocks.size() };
+
+	for (size_t k{ 0 }; alive.size() > minSurvivors || k < RACE_FIRST_TEST; k++) {
+		// RACE_NEW_BLOCKS new blocks first, then the ones of the previous races, then new ones again
+		size_t b{ (k < RACE_NEW_BLOCKS) ? seen + k : (k < RACE_NEW_BLOCKS + seen) ? k - RACE_NEW_BLOCKS : k };
+
+		// Runs the next block needs (elites may have it cached)
+		size_t needed{ 0 };
+		for (size_t c : alive)
+			needed += !cache.contains({ c, b });
+		if (used + needed > raceBudget)
+			break;
+
+		used += evaluate(alive, b);
+		visited.push_back(b);
+#if ACS_VERBOSE >= VERBOSE
+		PRINT_INFO("Race %zu - Block %zu [%s - seed %llu] -- %zu configurations", iteration + 1, b, instances[block(b).instance].name.c_str(), block(b).seed, alive.size());
+#endif
+
+		if (visited.size() >= RACE_FIRST_TEST && (visited.size() - RACE_FIRST_TEST) % RACE_EACH_TEST == 0)
+			friedmanTest(iteration, alive, visited);
+	}
+	return used;
+}
+
+void IteratedRace::friedmanTest(size_t iteration, std::vector<size_t>& alive, const std::vector<size_t>& visited) {
+	const double n{ static_cast<double>(alive.size()) };
+	const double k{ static_cast<double>(visited.size()) };
+	if (alive.size() < 2)
+		return;
+
+	double				sumSq{ 0.0 };
+	std::vector<double> sums{ rankSums(alive, visited, sumSq) };
+	const double		C{ k * n * (n + 1) * (n + 1) / 4.0 };
+	if (sumSq - C < EPSILON)
+		return; // All the runs tie
+
+	double dev{ 0.0 }, sumR2{ 0.0 };
+	for (double R : sums) {
+		dev += (R - k * (n + 1) / 2.0) * (R - k * (n + 1) / 2.0);
+		sumR2 += R * R;
+	}
+	Test test{ .iteration = iteration, .blocks = visited, .alive = alive, .statistic = (n - 1) * dev / (sumSq - C), .pValue = 1.0, .eliminated = {} };
+	test.pValue = chiSquareSF(test.statistic, n - 1);
+
+	if (test.pValue < RACE_ALPHA) {
+		// Conover post-hoc: discard the configurations whose rank sum exceeds the best one by the critical difference
+		double df{ (k - 1) * (n - 1) };
+		double critical{ tQuantile(1.0 - RACE_ALPHA / 2.0, df) * std::sqrt(2.0 * (k * sumSq - sumR2) / df) };
+		double best{ *std::min_element(sums.begin(), sums.end()) };
+
+		std::vector<size_t> survivors;
+		for (size_t i{ 0 }; i < alive.size(); i++) {
+			if (sums[i] - best > critical)
+				test.eliminated.push_back(alive[i]);
+			else
+				survivors.push_back(alive[i]);
+		}
+		alive = std::move(survivors);
+	}
+
+#if ACS_VERBOSE >= VERBOSE
+	PRINT_INFO("Race %zu - Friedman on %zu blocks: T = %.4f, p = %.4g -- Discarded: %zu -- Alive: %zu", iteration + 1, visited.size(), test.statistic, test.pValue, test.eliminated.size(), alive.size());
+#endif
+	tests.push_back(std::move(test));
+}
+
+std::vector<double> IteratedRace::rankSums(const std::vector<size_t>& alive, const std::vector<size_t>& visited, double& sumSqRanks) {
+	std::vector<double> sums(alive.size(), 0.0);
+	std::vector<size_t> order(alive.size());
+	std::vector<double> scores(alive.size());
+	sumSqRanks = 0.0;
+
+	for (size_t b : visited) {
+		for (size_t i{ 0 }; i < alive.size(); i++)
+			scores[i] = runs[cache.at({ alive[i], b })].result.score;
+		std::iota(order.begin(), order.end(), 0);
+		std::stable_sort(order.begin(), order.end(), [&](size_t x, size_t y) { return scores[x] < scores[y]; });
+
+		// Ties share the average of their ranks
+		for (size_t i{ 0 }; i < order.size();) {
+			size_t j{ i };
+			while (j + 1 < order.size() && std::abs(scores[order[j + 1]] - scores[order[i]]) < EPSILON)
+				j++;
+			double rank{ (i + j) / 2.0 + 1.0 };
+			for (size_t t{ i }; t <= j; t++) {
+				sums[order[t]] += rank;
+				sumSqRanks += rank * rank;
+			}
+			i = j + 1;
+		}
+	}
+	return sums;
+}
+
+double IteratedRace::chiSquareSF(double x, double df) {
+	// Regularized upper incomplete gamma Q(df/2, x/2): series for small x, continued fraction otherwise
+	const double a{ df / 2.0 }, z{ x / 2.0 };
+	if (z <= 0.0)
+		return 1.0;
+	const double logPref{ -z + a * std::log(z) - std::lgamma(a) };
+
+	if (z < a + 1.0) {
+		double ap{ a }, del{ 1.0 / a }, sum{ del };
+		for (size_t i{ 0 }; i < 1000 && std::abs(del) > std::abs(sum) * 1e-14; i++) {
+			ap += 1.0;
+			del *= z / ap;
+			sum += del;
+		}
+		return std::max(0.0, 1.0 - sum * std::exp(logPref));
+	}
+
+	const double tiny{ 1e-300 };
+	double		 b{ z + 1.0 - a }, c{ 1.0 / tiny }, d{ 1.0 / b }, h{ d };
+	for (size_t i{ 1 }; i < 1000; i++) {
+		double an{ -static_cast<double>(i) * (i - a) };
+		b += 2.0;
+		d = an * d + b;
+		d = (std::abs(d) < tiny) ? 1.0 / tiny : 1.0 / d;
+		c = b + an / c;
+		c = (std::abs(c) < tiny) ? tiny : c;
+		double del{ d * c };
+		h *= del;
+		if (std::abs(del - 1.0) < 1e-14)
+			break;
+	}
+	return std::exp(logPref) * h;
+}
+
+double IteratedRace::tQuantile(double p, double df) {
+	// Regularized incomplete beta by continued fraction (modified Lentz)
+	auto betaCF = [](double a, double b, double x) {
+		const double tiny{ 1e-300 };
+		double		 c{ 1.0 }, d{ 1.0 - (a + b) * x / (a + 1.0) };
+		d = (std::abs(d) < tiny) ? 1.0 / tiny : 1.0 / d;
+		double h{ d };
+		for (size_t m{ 1 }; m < 1000; m++) {
+			double aa{ m * (b - m) * x / ((a + 2.0 * m - 1.0) * (a + 2.0 * m)) };
+			d = 1.0 + aa * d;
+			d = (std::abs(d) < tiny) ? 1.0 / tiny : 1.0 / d;
+			c = 1.0 + aa / c;
+			c = (std::abs(c) < tiny) ? tiny : c;
+			h *= d * c;
+			aa = -(a + m) * (a + b + m) * x / ((a + 2.0 * m) * (a + 2.0 * m + 1.0));
+			d = 1.0 + aa * d;
+			d = (std::abs(d) < tiny) ? 1.0 / tiny : 1.0 / d;
+			c = 1.0 + aa / c;
+			c = (std::abs(c) < tiny) ? tiny : c;
+			double del{ d * c };
+			h *= del;
+			if (std::abs(del - 1.0) < 1e-14)
+				break;
+		}
+		return h;
+	};
+	auto incBeta = [&](double a, double b, double x) {
+		if (x <= 0.0 || x >= 1.0)
+			return (x <= 0.0) ? 0.0 : 1.0;
+		double front{ std::exp(std::lgamma(a + b) - std::lgamma(a) - std::lgamma(b) + a * std::log(x) + b * std::log(1.0 - x)) };
+		return (x < (a + 1.0) / (a + b + 2.0)) ? front * betaCF(a, b, x) / a : 1.0 - front * betaCF(b, a, 1.0 - x) / b;
+	};
+	// P(T <= t) for t >= 0
+	auto cdf = [&](double t) { return 1.0 - 0.5 * incBeta(df / 2.0, 0.5, df / (df + t * t)); };
+
+	double lo{ 0.0 }, hi{ 1.0 };
+	while (cdf(hi) < p && hi < 1e6)
+		hi *= 2.0;
+	for (size_t i{ 0 }; i < 200 && hi - lo > 1e-10; i++) {
+		double mid{ (lo + hi) / 2.0 };
+		if (cdf(mid) < p)
+			lo = mid;
+		else
+			hi = mid;
+	}
+	return (lo + hi) / 2.0;
+}
+
+std::vector<IteratedRace::Param> IteratedRace::loadSpace(const std::string& fileName) {
+	std::vector<std::string> lines;
+	if (fileName.empty()) {
+		for (const char* line : RACE_DEFAULT_SPACE)
+			lines.push_back(line);
+	} else {
+		std::ifstream file(fileName);
+		if (!file)
+			throw RaceException(ACSEx::FileNotFound, "Unable to read the parameter space " + fileName);
+		for (std::string line; std::getline(file, line);) {
+			size_t first{ line.find_first_not_of(" \t\r") };
+			if (first != std::string::npos && line[first] != '#')
+				lines.push_back(line);
+		}
+	}
+
+	std::vector<Param> space;
+	for (const std::string& line : lines) {
+		std::istringstream iss(line);
+		Param			   param;
+		std::string		   type;
+		iss >> param.name >> param.flag >> type;
+		for (double v; iss >> v;)
+			param.values.push_back(v);
+		param.type = type.empty() ? '?' : type[0];
+
+		bool valid{ param.type == 'c' ? !param.values.empty() : (param.values.size() == 2 && param.values[0] <= param.values[1]) };
+		if (!valid || (param.type != 'r' && param.type != 'i' && param.type != 'c') || param.flag.empty() || param.flag[0] != '-')
+			throw RaceException(ACSEx::WrongArgsValue, "Malformed parameter \"" + line + "\"");
+		space.push_back(std::move(param));
+	}
+	return space;
+}
+
+std::vector<IteratedRace::Instance> IteratedRace::loadInstances(const std::string& fileName) {
+	std::ifstream file(fileName);
+	if (!file)
+		throw RaceException(ACSEx::FileNotFound, "Unable to read the instance list " + fileName);
+
+	std::vector<Instance> list;
+	std::string			  line;
+	std::getline(file, line); // Header
+	while (std::getline(file, line)) {
+		if (!line.empty() && line.back() == '\r')
+			line.pop_back();
+		if (line.empty())
+			continue;
+
+		size_t		comma{ line.find(',') };
+		std::string obj{ comma == std::string::npos ? "" : line.substr(comma + 1, line.find(',', comma + 1) - comma - 1) };
+		char*		end{ nullptr };
+		double		value{ std::strtod(obj.c_str(), &end) };
+		list.push_back({ .name = line.substr(0, comma), .objective = (obj.empty() || end == obj.c_str()) ? std::numeric_limits<double>::quiet_NaN() : value });
+	}
+
+	if (list.empty())
+		throw RaceException(ACSEx::InputSizeError, "No instance in " + fileName);
+	return list;
+}
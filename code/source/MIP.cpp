@@ -18,6 +18,14 @@ std::vector<char>	MIP::MIPsense;
 std::vector<std::vector<int>> MIP::MIPVarToConstr;
 std::vector<std::vector<int>> MIP::MIPConstrToVar;
 
+std::vector<char> MIP::MIPctype;
+std::vector<int>  MIP::MIPIntVars;
+std::vector<int>  MIP::MIPContVars;
+
+InstanceFeatures MIP::MIPFeatures{};
+
+static std::once_flag MIPDataFlag;
+
 MIP::MIP(const std::string fileName) {
 #if ACS_VERBOSE == DEBUG
 	std::ostringstream oss;
@@ -43,57 +51,102 @@ MIP::MIP(const std::string fileName) {
 	CPXsetintparam(env, CPX_PARAM_CLONELOG, -1);
 #endif
 
-	if (MIPrmatbeg.empty() || MIPrmatind.empty() || MIPrmatval.empty()) {
-		size_t numRows = getNumRows();
-		size_t nzcnt = getNumNonZeros();
+	// Shared data of the original MIP: read once, also when the first models are built concurrently
+	std::call_once(MIPDataFlag, [this]() {
+		if (MIPrmatbeg.empty() || MIPrmatind.empty() || MIPrmatval.empty()) {
+			size_t numRows = getNumRows();
+			size_t nzcnt = getNumNonZeros();
+
+			MIPrmatbeg.resize(numRows);
+			MIPrmatind.resize(nzcnt);
+			MIPrmatval.resize(nzcnt);
+			MIPVarToConstr.resize(getMIPNumVars());
+			MIPConstrToVar.resize(numRows);
+
+			int surplus, nnCPLEX; // Dummy values necessary for CPLXgetrows
+			if (CPXgetrows(env, model, &nnCPLEX, MIPrmatbeg.data(), MIPrmatind.data(), MIPrmatval.data(), nzcnt, &surplus, 0, numRows - 1))
+				throw MIPException(MIPEx::GetFunction, "Error on retriving the matrix rows");
+
+			for (size_t i{ 0 }; i < numRows; i++) {
+				int start = MIPrmatbeg[i];
+				int end = (i == numRows - 1) ? MIPrmatind.size() : MIPrmatbeg[i + 1];
+
+				for (int j{ start }; j < end; ++j) {
+					int varIndex = MIPrmatind[j];
+					MIPVarToConstr[varIndex].push_back(i);
+					MIPConstrToVar[i].push_back(varIndex);
+				}
+			}
 
-		MIPrmatbeg.resize(numRows);
-		MIPrmatind.resize(nzcnt);
-		MIPrmatval.resize(nzcnt);
-		MIPVarToConstr.resize(getMIPNumVars());
-		MIPConstrToVar.resize(numRows);
+			for (auto e : MIPVarToConstr) {
+				for (auto c : e) {
+					if (c < 0 || c > static_cast<int>(numRows))
+						throw MIPException(MIPEx::GetFunction, "Error on VarToConstr");
+				}
+			}
 
-		int surplus, nnCPLEX; // Dummy values necessary for CPLXgetrows
-		if (CPXgetrows(env, model, &nnCPLEX, MIPrmatbeg.data(), MIPrmatind.data(), MIPrmatval.data(), nzcnt, &surplus, 0, numRows - 1))
-			throw MIPException(MIPEx::GetFunction, "Error on retriving the matrix rows");
+			for (auto e : MIPConstrToVar) {
+				for (auto v : e) {
+					if (v < 0 || v >  static_cast<int>(getMIPNumVars()))
+						throw MIPException(MIPEx::GetFunction, "Error on ConstrToVar");
+				}
+			}
+		}
 
-		for (size_t i{ 0 }; i < numRows; i++) {
-			int start = MIPrmatbeg[i];
-			int end = (i == numRows - 1) ? MIPrmatind.size() : MIPrmatbeg[i + 1];
+		if (MIPrhs.empty() || MIPsense.empty()) {
+			size_t numRows = getNumRows();
 
-			for (int j{ start }; j < end; ++j) {
-				int varIndex = MIPrmatind[j];
-				MIPVarToConstr[varIndex].push_back(i);
-				MIPConstrToVar[i].push_back(varIndex);
-			}
+			MIPrhs.resize(numRows);
+			if (CPXgetrhs(env, model, MIPrhs.data(), 0, numRows - 1))
+				throw MIPException(MIPEx::GetFunction, "Error on retriving the RHS values");
+
+			MIPsense.resize(numRows);
+			if (CPXgetsense(env, model, MIPsense.data(), 0, numRows - 1))
+				throw MIPException(MIPEx::GetFunction, "Error on retriving the RHS values");
 		}
 
-		for (auto e : MIPVarToConstr) {
-			for (auto c : e) {
-				if (c < 0 || c > static_cast<int>(numRows))
-					throw MIPException(MIPEx::GetFunction, "Error on VarToConstr");
+		if (MIPctype.empty()) {
+			size_t numVars = getMIPNumVars();
+
+			MIPctype.resize(numVars, CPX_CONTINUOUS);
+			if (CPXgetprobtype(env, model) != CPXPROB_LP && CPXgetctype(env, model, MIPctype.data(), 0, numVars - 1))
+				throw MIPException(MIPEx::GetFunction, "Error on retriving the variable types");
+
+			for (size_t j{ 0 }; j < numVars; j++) {
+				if (MIPctype[j] == CPX_BINARY || MIPctype[j] == CPX_INTEGER)
+					MIPIntVars.push_back(static_cast<int>(j));
+				else
+					MIPContVars.push_back(static_cast<int>(j));
 			}
 		}
 
-		for (auto e : MIPConstrToVar) {
-			for (auto v : e) {
-				if (v < 0 || v >  static_cast<int>(getMIPNumVars()))
-					throw MIPException(MIPEx::GetFunction, "Error on ConstrToVar");
+		if (!MIPFeatures.cols) {
+			size_t numRows = getNumRows();
+			size_t numVars = getMIPNumVars();
+			size_t numBin = std::count(MIPctype.begin(), MIPctype.end(), CPX_BINARY);
+
+			MIPFeatures.rows = numRows;
+			MIPFeatures.cols = numVars;
+			MIPFeatures.nnz = MIPrmatind.size();
+			MIPFeatures.density = (numRows && numVars) ? static_cast<double>(MIPFeatures.nnz) / (static_cast<double>(numRows) * numVars) : 0.0;
+			MIPFeatures.binFrac = numVars ? static_cast<double>(numBin) / numVars : 0.0;
+			MIPFeatures.intFrac = numVars ? static_cast<double>(MIPIntVars.size() - numBin) / numVars : 0.0;
+			MIPFeatures.contFrac = numVars ? static_cast<double>(MIPContVars.size()) / numVars : 0.0;
+
+			double sumLen{ 0.0 }, sumSqLen{ 0.0 };
+			MIPFeatures.rowLenMin = numRows ? SIZE_MAX : 0;
+			MIPFeatures.rowLenMax = 0;
+			for (const auto& row : MIPConstrToVar) {
+				sumLen += row.size();
+				sumSqLen += static_cast<double>(row.size()) * row.size();
+				MIPFeatures.rowLenMin = std::min(MIPFeatures.rowLenMin, row.size());
+				MIPFeatures.rowLenMax = std::max(MIPFeatures.rowLenMax, row.size());
 			}
+			MIPFeatures.rowLenMean = numRows ? sumLen / numRows : 0.0;
+			MIPFeatures.rowLenStd = numRows ? std::sqrt(std::max(0.0, sumSqLen / numRows - MIPFeatures.rowLenMean * MIPFeatures.rowLenMean)) : 0.0;
+			MIPFeatures.eqFrac = numRows ? static_cast<double>(std::count(MIPsense.begin(), MIPsense.end(), EQ)) / numRows : 0.0;
 		}
-	}
-
-	if (MIPrhs.empty() || MIPsense.empty()) {
-		size_t numRows = getNumRows();
-
-		MIPrhs.resize(numRows);
-		if (CPXgetrhs(env, model, MIPrhs.data(), 0, numRows - 1))
-			throw MIPException(MIPEx::GetFunction, "Error on retriving the RHS values");
-
-		MIPsense.resize(numRows);
-		if (CPXgetsense(env, model, MIPsense.data(), 0, numRows - 1))
-			throw MIPException(MIPEx::GetFunction, "Error on retriving the RHS values");
-	}
+	});
 }
 
 MIP::MIP(const MIP& otherMIP) {
@@ -122,12 +175,50 @@ MIP& MIP::setNumCores(const int numCores) {
 	return *this;
 }
 
+MIP& MIP::setCPUMask(const std::vector<int>& cpus) {
+	std::string mask{ "auto" };
+
+	if (!cpus.empty()) {
+		// Hexadecimal mask, bit i set for CPU i (most significant digit first)
+		std::vector<int> nibbles((*std::max_element(cpus.begin(), cpus.end())) / 4 + 1, 0);
+		for (int cpu : cpus)
+			nibbles[cpu / 4] |= 1 << (cpu % 4);
+
+		mask.clear();
+		for (auto it{ nibbles.rbegin() }; it != nibbles.rend(); it++)
+			mask.push_back("0123456789abcdef"[*it]);
+	}
+
+	if (CPXsetstrparam(env, CPXPARAM_CPUmask, mask.c_str()))
+		throw MIPException(MIPEx::SetFunction, "CPU mask not changed!");
+	return *this;
+}
+
+MIP& MIP::setDeterministic() {
+	if (CPXsetintparam(env, CPX_PARAM_PARALLELMODE, CPX_PARALLEL_DETERMINISTIC))
+		throw MIPException(MIPEx::SetFunction, "Parallel mode not changed!");
+	return *this;
+}
+
 MIP& MIP::setNumSols(const int numSols) {
 	if (CPXsetintparam(env, CPX_PARAM_INTSOLLIM, numSols))
 		throw MIPException(MIPEx::SetFunction, "Number of max solutions not changed!");
 	return *this;
 }
 
+MIP& MIP::setCutoff(const double cutoff) {
+	if (CPXsetdblparam(env, CPX_PARAM_CUTUP, cutoff))
+		throw MIPException(MIPEx::SetFunction, "Objective cutoff not changed!");
+	cutoffSet = (cutoff < CPX_INFBOUND);
+	return *this;
+}
+
+MIP& MIP::setObjStop(const double objStop) {
+	if (CPXsetdblparam(env, CPX_PARAM_LOWEROBJSTOP, objStop))
+		throw MIPException(MIPEx::SetFunction, "Lower objective stop not changed!");
+	return *this;
+}
+
 size_t MIP::getNumNonZeros() {
 	int nnz{ (CPXgetnumnz(env, model)) };
 	if (!nnz)
@@ -146,9 +237,41 @@ int MIP::solve(const double timeLimit, const double detTimeLimit) {
 	if (detTimeLimit < CPX_INFBOUND) [[likely]]
 		CPXsetdblparam(env, CPX_PARAM_DETTILIM, detTimeLimit);
 
+	double startDetTime{ 0.0 }, endDetTime{ 0.0 };
+	CPXgetdettime(env, &startDetTime);
+
 	if (int error{ CPXmipopt(env, model) })
 		throw MIPException(MIPEx::MIP_OptimizationError, "CPLEX cannot solve this problem!\t" + std::to_string(error));
 
+	CPXgetdettime(env, &endDetTime);
+	lastDetTime = endDetTime - startDetTime;
+
+	return CPXgetstat(env, model);
+}
+
+int MIP::solveLP(const double timeLimit, const double detTimeLimit) {
+
+	if (timeLimit < EPSILON)
+		throw MIPException(MIPEx::WrongTimeLimit, "Time-limit too short!\t" + std::to_string(timeLimit));
+
+	if (timeLimit < CPX_INFBOUND) [[likely]]
+		CPXsetdblparam(env, CPX_PARAM_TILIM, timeLimit);
+
+	if (detTimeLimit < CPX_INFBOUND) [[likely]]
+		CPXsetdblparam(env, CPX_PARAM_DETTILIM, detTimeLimit);
+
+	if (CPXchgprobtype(env, model, CPXPROB_LP))
+		throw MIPException(MIPEx::SetFunction, "Problem type not changed!");
+
+	double startDetTime{ 0.0 }, endDetTime{ 0.0 };
+	CPXgetdettime(env, &startDetTime);
+
+	if (int error{ CPXlpopt(env, model) })
+		throw MIPException(MIPEx::LP_OptimizationError, "CPLEX cannot solve the relaxed problem!\t" + std::to_string(error));
+
+	CPXgetdettime(env, &endDetTime);
+	lastDetTime = endDetTime - startDetTime;
+
 	return CPXgetstat(env, model);
 }
 
@@ -168,6 +291,29 @@ MIP& MIP::addMIPStart(const std::vector<double>& MIPStart, bool CPLEXCheck) {
 	return *this;
 }
 
+MIP& MIP::addMIPVarsStart(const std::vector<double>& MIPVarsStart) {
+	size_t numMIPVars{ getMIPNumVars() };
+	if (MIPVarsStart.size() < numMIPVars)
+		throw MIPException(MIPEx::InputSizeError, "Wrong MIP start length");
+
+	int start_index = 0;
+	int effort_level = CPX_MIPSTART_SOLVEFIXED;
+
+	std::vector<int> indices(numMIPVars, 0);
+	std::iota(indices.begin(), indices.end(), 0);
+
+	if (int error{ CPXaddmipstarts(env, model, 1, numMIPVars, &start_index, indices.data(), MIPVarsStart.data(), &effort_level, NULL) })
+		throw MIPException(MIPEx::SetFunction, "Unable to set the MIP start!\t" + std::to_string(error));
+	return *this;
+}
+
+MIP& MIP::deleteMIPStarts() {
+	int numStarts{ CPXgetnummipstarts(env, model) };
+	if (numStarts > 0 && CPXdelmipstarts(env, model, 0, numStarts - 1))
+		throw MIPException(MIPEx::SetFunction, "Unable to delete the MIP starts!");
+	return *this;
+}
+
 double MIP::getObjValue() {
 	double objValue;
 	if (int error{ CPXgetobjval(env, model, &objValue) })
@@ -209,6 +355,16 @@ std::vector<double> MIP::getSol() {
 	return sol;
 }
 
+std::vector<double> MIP::getReducedCosts() {
+	size_t	numCols{ getNumCols() };
+	double* dj{ (double*)calloc(numCols, sizeof(double)) };
+	if (int error{ CPXgetdj(env, model, dj, 0, numCols - 1) })
+		throw MIPException(MIPEx::GetFunction, "Unable to obtain the reduced costs!\t" + std::to_string(error));
+	std::vector<double> redCosts(dj, dj + numCols);
+	free(dj);
+	return redCosts;
+}
+
 size_t MIP::getMIPNumVars() {
 	int numCols{ CPXgetnumcols(env, model) };
 	if (!numCols)
@@ -236,8 +392,8 @@ MIP& MIP::addCol(const std::vector<double>& newCol, const double objCoef, const
 	if (newCol.size() != numRow)
 		throw MIPException(MIPEx::InputSizeError, "Wrong new column size");
 
-	char** cname{ (char**)calloc(1, sizeof(char*)) };
-	cname[0] = strdup(name.c_str());
+	std::string tmpName{ name };
+	char*		cname{ tmpName.data() };
 
 	int*	indices{ (int*)malloc(numRow * sizeof(int)) };
 	double* values{ (double*)malloc(numRow * sizeof(double)) };
@@ -250,9 +406,8 @@ MIP& MIP::addCol(const std::vector<double>& newCol, const double objCoef, const
 		}
 	}
 
-	if (CPXaddcols(env, model, 1, nnz, &objCoef, &start, indices, values, &lb, &ub, &cname[0]))
+	if (CPXaddcols(env, model, 1, nnz, &objCoef, &start, indices, values, &lb, &ub, &cname))
 		throw MIPException(MIPEx::SetFunction, "No column added!");
-	free(cname);
 	free(indices);
 	free(values);
 	return *this;
@@ -262,19 +417,69 @@ MIP& MIP::addCol(const size_t index, const double value, const double objCoef, c
 	if (index > getNumRows() - 1)
 		throw MIPException(MIPEx::OutOfBound, "Wrong index addCol()!");
 
-	char** cname{ (char**)calloc(1, sizeof(char*)) };
-	cname[0] = strdup(name.c_str());
+	std::string tmpName{ name };
+	char*		cname{ tmpName.data() };
 
 	int	   tmpIndex{ static_cast<int>(index) };
 	double tmpValue{ value };
 	int	   start{ 0 }, nnz{ 1 };
 
-	if (CPXaddcols(env, model, 1, nnz, &objCoef, &start, &tmpIndex, &tmpValue, &lb, &ub, &cname[0]))
+	if (CPXaddcols(env, model, 1, nnz, &objCoef, &start, &tmpIndex, &tmpValue, &lb, &ub, &cname))
 		throw MIPException(MIPEx::SetFunction, "No column added!");
-	free(cname);
 	return *this;
 }
 
+MIP& MIP::addCols(const std::vector<double>& objCoefs, const std::vector<int>& cmatbeg, const std::vector<int>& cmatind, const std::vector<double>& cmatval,
+				  const std::vector<double>& lbs, const std::vector<double>& ubs, const std::vector<std::string>& names) {
+	size_t numNewCols{ objCoefs.size() };
+
+	if (cmatbeg.size() != numNewCols || lbs.size() != numNewCols || ubs.size() != numNewCols || (!names.empty() && names.size() != numNewCols))
+		throw MIPException(MIPEx::InputSizeError, "Wrong new columns size");
+	if (cmatind.size() != cmatval.size())
+		throw MIPException(MIPEx::InputSizeError, "Wrong new columns non-zeros size");
+
+	std::vector<char*> cnames;
+	if (!names.empty()) {
+		cnames.reserve(numNewCols);
+		for (const auto& name : names)
+			cnames.push_back(const_cast<char*>(name.c_str()));
+	}
+
+	if (CPXaddcols(env, model, numNewCols, cmatind.size(), objCoefs.data(), cmatbeg.data(), cmatind.data(), cmatval.data(), lbs.data(), ubs.data(),
+				   (cnames.empty()) ? NULL : cnames.data()))
+		throw MIPException(MIPEx::SetFunction, "No columns added!");
+	return *this;
+}
+
+void MIP::addSlackCols(const double objCoef) {
+	size_t numRows{ getNumRows() };
+	size_t numSlacks{ 2 * numRows };
+
+	std::vector<int>	cmatbeg(numSlacks);
+	std::vector<int>	cmatind(numSlacks);
+	std::vector<double> cmatval(numSlacks);
+	for (size_t i{ 0 }; i < numRows; i++) {
+		cmatbeg[i] = i;
+		cmatind[i] = i;
+		cmatval[i] = 1;
+
+		cmatbeg[numRows + i] = numRows + i;
+		cmatind[numRows + i] = i;
+		cmatval[numRows + i] = -1;
+	}
+
+	std::vector<std::string> names;
+#if MIP_COL_NAMES
+	names.reserve(numSlacks);
+	for (size_t i{ 0 }; i < numRows; i++)
+		names.push_back("SP_" + std::to_string(i + 1));
+	for (size_t i{ 0 }; i < numRows; i++)
+		names.push_back("SN_" + std::to_string(i + 1));
+#endif
+
+	addCols(std::vector<double>(numSlacks, objCoef), cmatbeg, cmatind, cmatval, std::vector<double>(numSlacks, 0.0), std::vector<double>(numSlacks, CPX_INFBOUND), names);
+}
+
 MIP& MIP::addRow(const std::vector<double>& newRow, const char sense, const double rhs) {
 	size_t numCols{ getNumCols() };
 
@@ -299,6 +504,26 @@ MIP& MIP::addRow(const std::vector<double>& newRow, const char sense, const doub
 	return *this;
 }
 
+MIP& MIP::addRow(const std::vector<int>& indices, const std::vector<double>& values, const char sense, const double rhs) {
+	if (indices.size() != values.size())
+		throw MIPException(MIPEx::InputSizeError, "Wrong new row size");
+
+	int start = 0;
+	if (CPXaddrows(env, model, 0, 1, indices.size(), &rhs, &sense, &start, indices.data(), values.data(), NULL, NULL))
+		throw MIPException(MIPEx::SetFunction, "No row added!");
+
+	if (journalOn) {
+		journalRows++;
+		journalRowsKey = Hash::mix(journalRowsKey, static_cast<uint64_t>(sense));
+		journalRowsKey = Hash::mix(journalRowsKey, std::bit_cast<uint64_t>(rhs));
+		for (size_t i{ 0 }; i < indices.size(); i++) {
+			journalRowsKey = Hash::mix(journalRowsKey, static_cast<uint64_t>(indices[i]));
+			journalRowsKey = Hash::mix(journalRowsKey, std::bit_cast<uint64_t>(values[i]));
+		}
+	}
+	return *this;
+}
+
 MIP& MIP::removeRow(const int index) {
 	if (index < 0 || static_cast<size_t>(index) > getNumRows() - 1)
 		throw MIPException(MIPEx::OutOfBound, "Wrong index removeRow()!");
@@ -329,6 +554,16 @@ VarBounds MIP::getVarBounds(const int index) {
 	return VarBounds{ .lowerBound = lb, .upperBound = ub };
 }
 
+MIP& MIP::getBounds(std::vector<double>& lb, std::vector<double>& ub) {
+	size_t numCols{ getNumCols() };
+	lb.resize(numCols);
+	ub.resize(numCols);
+
+	if (numCols && (CPXgetlb(env, model, lb.data(), 0, numCols - 1) || CPXgetub(env, model, ub.data(), 0, numCols - 1)))
+		throw MIPException(MIPEx::GetFunction, "Unable to get the variable bounds!");
+	return *this;
+}
+
 char MIP::getVarType(const int index) {
 	if (index < 0 || static_cast<size_t>(index) > getNumCols() - 1)
 		throw MIPException(MIPEx::OutOfBound, "Wrong index getVarType()! - " + std::to_string(index));
@@ -346,6 +581,8 @@ MIP& MIP::setVarValue(const int index, const double val) {
 	char bound{ BOTH_BOUNDS };
 	if (CPXchgbds(env, model, 1, &index, &bound, &val))
 		throw MIPException(MIPEx::SetFunction, "Unable to set the value to var " + std::to_string(val));
+	if (journalOn)
+		journalIdx.push_back(index);
 	return *this;
 }
 
@@ -356,6 +593,8 @@ MIP& MIP::setVarLowerBound(const int index, const double newLB) {
 	char bound{ LW_BOUND };
 	if (CPXchgbds(env, model, 1, &index, &bound, &newLB))
 		throw MIPException(MIPEx::SetFunction, "Unable to set the lower bound of the var  " + std::to_string(newLB));
+	if (journalOn)
+		journalIdx.push_back(index);
 	return *this;
 }
 
@@ -366,6 +605,8 @@ MIP& MIP::setVarUpperBound(const int index, const double newUB) {
 	char bound{ UP_BOUND };
 	if (CPXchgbds(env, model, 1, &index, &bound, &newUB))
 		throw MIPException(MIPEx::SetFunction, "Unable to set the upper bound of the var " + std::to_string(newUB));
+	if (journalOn)
+		journalIdx.push_back(index);
 	return *this;
 }
 
@@ -380,6 +621,88 @@ MIP& MIP::setVarsValues(const std::vector<double>& values) {
 	return *this;
 }
 
+MIP& MIP::setVarsValues(const std::vector<int>& indices, const std::vector<double>& values) {
+	if (indices.size() != values.size())
+		throw MIPException(MIPEx::InputSizeError, "Wrong new values_array size!");
+	if (indices.empty())
+		return *this;
+
+	std::vector<char> bounds(indices.size(), BOTH_BOUNDS);
+	if (int error{ CPXchgbds(env, model, indices.size(), indices.data(), bounds.data(), values.data()) })
+		throw MIPException(MIPEx::SetFunction, "Unable to set the values of " + std::to_string(indices.size()) + " vars!\t" + std::to_string(error));
+	if (journalOn)
+		journalIdx.insert(journalIdx.end(), indices.begin(), indices.end());
+	return *this;
+}
+
+MIP& MIP::setVarsBounds(const std::vector<int>& indices, const std::vector<double>& lbs, const std::vector<double>& ubs) {
+	if (indices.size() != lbs.size() || indices.size() != ubs.size())
+		throw MIPException(MIPEx::InputSizeError, "Wrong new bounds_array size!");
+	if (indices.empty())
+		return *this;
+
+	std::vector<int>	idx(2 * indices.size());
+	std::vector<char>	lu(2 * indices.size());
+	std::vector<double> bd(2 * indices.size());
+	for (size_t i{ 0 }; i < indices.size(); i++) {
+		idx[2 * i] = idx[2 * i + 1] = indices[i];
+		lu[2 * i] = LW_BOUND;
+		lu[2 * i + 1] = UP_BOUND;
+		bd[2 * i] = lbs[i];
+		bd[2 * i + 1] = ubs[i];
+	}
+
+	if (int error{ CPXchgbds(env, model, idx.size(), idx.data(), lu.data(), bd.data()) })
+		throw MIPException(MIPEx::SetFunction, "Unable to set the bounds of " + std::to_string(indices.size()) + " vars!\t" + std::to_string(error));
+	if (journalOn)
+		journalIdx.insert(journalIdx.end(), indices.begin(), indices.end());
+	return *this;
+}
+
+MIP& MIP::startBoundJournal() {
+	getBounds(journalLB, journalUB);
+	journalIdx.clear();
+	journalRows = 0;
+	journalRowsKey = Hash::OFFSET;
+	journalOn = true;
+	return *this;
+}
+
+MIP& MIP::restoreBounds() {
+	if (!journalOn)
+		throw MIPException(MIPEx::SetFunction, "No bound journal to restore!");
+
+	std::sort(journalIdx.begin(), journalIdx.end());
+	journalIdx.erase(std::unique(journalIdx.begin(), journalIdx.end()), journalIdx.end());
+
+	std::vector<int>	indices;
+	std::vector<char>	lu;
+	std::vector<double> bd;
+	indices.reserve(2 * journalIdx.size());
+	lu.reserve(2 * journalIdx.size());
+	bd.reserve(2 * journalIdx.size());
+
+	for (int index : journalIdx) {
+		indices.insert(indices.end(), { index, index });
+		lu.insert(lu.end(), { LW_BOUND, UP_BOUND });
+		bd.insert(bd.end(), { journalLB[index], journalUB[index] });
+	}
+
+	if (!indices.empty() && CPXchgbds(env, model, indices.size(), indices.data(), lu.data(), bd.data()))
+		throw MIPException(MIPEx::SetFunction, "Unable to restore the variable bounds!");
+
+	if (journalRows) {
+		int numRows{ static_cast<int>(getNumRows()) };
+		if (CPXdelrows(env, model, numRows - static_cast<int>(journalRows), numRows - 1))
+			throw MIPException(MIPEx::SetFunction, "Unable to remove the recorded rows!");
+		journalRows = 0;
+		journalRowsKey = Hash::OFFSET;
+	}
+
+	journalIdx.clear();
+	return *this;
+}
+
 double MIP::checkFeasibility(const std::vector<double>& sol) {
 	if (sol.size() != getNumCols())
 		throw MIPException(MIPEx::InputSizeError, "Wrong solution size!");
@@ -1,27 +1,53 @@
 #include "../include/MTContext.hpp"
 
-MTContext::MTContext(size_t subMIPNum, unsigned long long intialSeed) : numMIPs{ subMIPNum } {
+MTContext::MTContext(size_t subMIPNum, unsigned long long intialSeed, size_t numCores, bool pin, bool elastic, bool deterministic, bool portfolio, size_t fixPolicy, size_t eliteSize, bool nbhCache, double rho) : numMIPs{ elastic ? std::max({ subMIPNum, numCores, static_cast<size_t>(ELASTIC_MIN_WORKERS) }) : subMIPNum },
+																																				 numActive{ subMIPNum },
+																																				 deterministic{ deterministic },
+																																				 elasticWorkers{ subMIPNum, numMIPs, elastic },
+																																				 detBudget{ numMIPs, deterministic },
+																																				 coreSched{ numCores, numMIPs, pin },
+																																				 policyPortfolio{ portfolio, deterministic, fixPolicy },
+																																				 elitePool{ eliteSize },
+																																				 nbhCache{ nbhCache },
+																																				 rhoCtl{ numMIPs, rho } {
 
 	bestACSIncumbent = { .sol = std::vector<double>(), .slackSum = CPX_INFBOUND, .oMIPCost = CPX_INFBOUND };
 	tmpSolutions = std::vector<Solution>();
 	threads = std::vector<std::thread>();
-	A_RhoChanges = 0;
+	A_NumSubMIPs = 0;
+	A_NumCutoffSubMIPs = 0;
+	A_IncumbentVersion = 0;
 
 	threads.reserve(numMIPs);
 	tmpSolutions.reserve(numMIPs);
 	rndGens.reserve(numMIPs);
+	prepared.reserve(numMIPs);
+	results.reserve(numMIPs);
+	reservedArms.resize(numMIPs, 0);
+	workerPolicies.resize(numMIPs, PolicyPortfolio::Policy::RandomRho);
+	workerBlocks.resize(numMIPs, -1);
+	blockCursor = 0;
+	fixTimes.resize(numMIPs, 0.0);
+	prevRefs.resize(numMIPs);
 
 	for (size_t i{ 0 }; i < numMIPs; i++) {
 		rndGens.emplace_back(intialSeed + (i + 1));
 		tmpSolutions.push_back({ .sol = std::vector<double>(), .slackSum = CPX_INFBOUND, .oMIPCost = CPX_INFBOUND });
+		prepared.push_back({ .model = nullptr, .rnd = rndGens[i], .rho = 0.0, .policy = PolicyPortfolio::Policy::RandomRho, .block = -1 });
+		results.push_back({ .pending = false, .phase = DetBudget::Phase::FMIP, .budget = { .detTL = 0.0, .arm = 0 }, .solveCode = 0, .ticks = 0.0, .solveTime = 0.0, .improvement = 0.0, .nnz = 0, .cutoff = false, .policy = PolicyPortfolio::Policy::RandomRho, .fixTime = 0.0, .signature = 0, .version = 0 });
 	}
 
+	preparedPhase = DetBudget::Phase::FMIP;
+	specIncumbent = bestACSIncumbent;
+	specVersion = 0;
+	phaseTimes.fill({ .setup = 0.0, .hidden = 0.0, .refresh = 0.0, .solve = 0.0, .prepared = 0, .refreshed = 0, .discarded = 0 });
+
 #if ACS_VERBOSE >= VERBOSE
-	PRINT_INFO("MT Context: Initialized -- Num schedulable jobs: %d", numMIPs);
+	PRINT_INFO("MT Context: Initialized -- Num schedulable jobs: %d (slots: %d) -- Core budget: %d", numActive, numMIPs, coreSched.getNumCores());
 #endif
 }
 
-void MTContext::setBestACSIncumbent(Solution& sol) {
+void MTContext::setBestACSIncumbent(const Solution& sol) {
 	std::lock_guard<std::mutex> lock(MTContextMTX);
 
 	/// FIXED: Bug #9d6c973e040c2a8da57051d05e46d92c6e366c45 -- Inconsistency between actual and saved objective values due to incorrect slack sum comparison
@@ -29,10 +55,12 @@ void MTContext::setBestACSIncumbent(Solution& sol) {
 	if ((std::abs(sol.slackSum) < std::abs(bestACSIncumbent.slackSum)) || (std::abs(sol.slackSum) < EPSILON && sol.oMIPCost < bestACSIncumbent.oMIPCost)) {
 
 		bestACSIncumbent = { .sol = sol.sol, .slackSum = sol.slackSum, .oMIPCost = sol.oMIPCost };
-		A_RhoChanges = numMIPs;
+		A_IncumbentVersion++;
 
-		if (bestACSIncumbent.oMIPCost < CPX_INFBOUND && bestACSIncumbent.slackSum <= EPSILON)
+		if (bestACSIncumbent.oMIPCost < CPX_INFBOUND && bestACSIncumbent.slackSum <= EPSILON) {
+			primalTrajectory.push_back({ .time = Clock::timeElapsed(), .cost = bestACSIncumbent.oMIPCost });
 			PRINT_BEST("New MIP Incumbent found %12.2f\t\t[*]", bestACSIncumbent.oMIPCost);
+		}
 
 #if ACS_VERBOSE >= VERBOSE
 		PRINT_INFO("New ACS Incumbent found %12.2f|%-10.2f\t[*]", bestACSIncumbent.oMIPCost, bestACSIncumbent.slackSum);
@@ -40,16 +68,109 @@ void MTContext::setBestACSIncumbent(Solution& sol) {
 	}
 }
 
+double MTContext::getPrimalIntegral(double endTime, size_t numSamples) {
+	numSamples = std::min(numSamples, primalTrajectory.size());
+	if (!numSamples)
+		return endTime;
+
+	const double bestCost{ primalTrajectory.back().cost };
+	auto		 gap = [bestCost](double cost) {
+		if (std::abs(cost - bestCost) < EPSILON)
+			return 0.0;
+		if (cost * bestCost < 0.0)
+			return 1.0;
+		return std::abs(cost - bestCost) / std::max(std::abs(cost), std::abs(bestCost));
+	};
+
+	double integral{ std::min(primalTrajectory.front().time, endTime) };
+	for (size_t s{ 0 }; s < numSamples; s++) {
+		double until{ (s + 1 < numSamples) ? primalTrajectory[s + 1].time : endTime };
+		integral += gap(primalTrajectory[s].cost) * std::max(0.0, std::min(until, endTime) - primalTrajectory[s].time);
+	}
+	return integral;
+}
+
+void MTContext::addPhaseTimes(DetBudget::Phase phase, double setup, double solve) {
+	std::lock_guard<std::mutex> lock(timesMTX);
+	phaseTimes[static_cast<size_t>(phase)].setup += setup;
+	phaseTimes[static_cast<size_t>(phase)].solve += solve;
+}
+
+void MTContext::setFMIPObjLimits(MIP& fMIP) {
+	fMIP.setObjStop(EPSILON);
+	if (bestACSIncumbent.slackSum < CPX_INFBOUND)
+		fMIP.setCutoff(bestACSIncumbent.slackSum);
+}
+
+void MTContext::setOMIPObjLimits(MIP& oMIP) {
+	if (isFeasibleSolFound())
+		oMIP.setCutoff(bestACSIncumbent.oMIPCost);
+}
+
+MTContext& MTContext::enablePropagation(const std::string& fileName) {
+	propagator = std::make_unique<Propagator>(fileName);
+#if ACS_VERBOSE >= VERBOSE
+	PRINT_INFO("MT Context: Bound propagation of the subMIPs on");
+#endif
+	return *this;
+}
+
+std::span<const Solution> MTContext::getMergeSolutions() {
+	if (!elitePool.isEnabled())
+		return getTmpSolutions();
+
+	// Duplicate worker solutions add no information to the recombination
+	std::unordered_set<uint64_t> hashes;
+	mergeSols.clear();
+	for (const Solution& sol : getTmpSolutions())
+		if (!sol.sol.empty() && hashes.insert(elitePool.hash(sol)).second)
+			mergeSols.push_back(sol);
+	for (Solution& sol : elitePool.getBest(ELITE_MERGE_SOLS))
+		if (hashes.insert(elitePool.hash(sol)).second)
+			mergeSols.push_back(std::move(sol));
+
+#if ACS_VERBOSE >= VERBOSE
+	PRINT_INFO("MT Context: Recombining %zu distinct solutions (%zu worker solutions)", mergeSols.size(), numActive);
+#endif
+	return mergeSols;
+}
+
 MTContext& MTContext::broadcastSol(Solution& tmpSol) {
 	waitAllJobs();
 
+	// Elite pool: some workers restart away from the broadcast solution
+	std::vector<Solution> elite;
+	if (elitePool.isEnabled())
+		elite = elitePool.getFarthest(tmpSol, numMIPs / ELITE_START_STRIDE);
+
 	for (size_t i{ 0 }; i < numMIPs; i++) {
-		threads.emplace_back(&MTContext::setTmpSolution, this, i, std::ref(tmpSol));
+		size_t e{ i / ELITE_START_STRIDE };
+		if ((i + 1) % ELITE_START_STRIDE == 0 && e < elite.size())
+			threads.emplace_back(&MTContext::setTmpSolution, this, i, std::ref(elite[e]));
+		else
+			threads.emplace_back(&MTContext::setTmpSolution, this, i, std::ref(tmpSol));
 	}
 
 	waitAllJobs();
 #if ACS_VERBOSE >= VERBOSE
-	PRINT_INFO("MT Context: Broadcasting main sol to all threads");
+	PRINT_INFO("MT Context: Broadcasting main sol to all threads (%zu elite starts)", std::min(elite.size(), numMIPs / ELITE_START_STRIDE));
+#endif
+	return *this;
+}
+
+MTContext& MTContext::seedSolutions(std::span<const Solution> sols) {
+	waitAllJobs();
+
+	for (size_t i{ 0 }; i < numMIPs; i++) {
+		threads.emplace_back([this, i, &sols]() {
+			coreSched.pinWorker(i);
+			tmpSolutions[i] = sols[i % sols.size()];
+		});
+	}
+
+	waitAllJobs();
+#if ACS_VERBOSE >= VERBOSE
+	PRINT_INFO("MT Context: Seeding the threads with %zu solutions", sols.size());
 #endif
 	return *this;
 }
@@ -61,32 +182,136 @@ void MTContext::waitAllJobs() {
 		}
 	}
 	threads.clear();
-	A_RhoChanges = 0;
 }
 
 MTContext& MTContext::parallelFMIPOptimization(Args& CLIArgs) {
 	waitAllJobs();
 
-	for (size_t i{ 0 }; i < CLIArgs.numsubMIPs; i++) {
-		threads.emplace_back(&MTContext::FMIPInstanceJob, this, i, std::ref(CLIArgs));
+	double roundTime{ Clock::getTime() };
+	numActive = activeWorkers(DetBudget::Phase::FMIP);
+	coreSched.startPhase(numActive);
+	drawPolicies(DetBudget::Phase::FMIP, numActive, true);
+	if (deterministic)
+		for (size_t i{ 0 }; i < numActive; i++)
+			reservedArms[i] = detBudget.reserveArm(DetBudget::Phase::FMIP);
+
+	for (size_t i{ 0 }; i < numActive; i++) {
+		threads.emplace_back([this, i, &CLIArgs]() {
+			coreSched.pinWorker(i);
+			FMIPInstanceJob(i, CLIArgs);
+			coreSched.release(i);
+		});
 	}
 
 	waitAllJobs();
+	if (deterministic)
+		roundTime = commitPhaseResults();
+	else
+		roundTime = Clock::timeElapsed(roundTime);
+	elasticWorkers.endRound(DetBudget::Phase::FMIP, roundTime);
+	CLIArgs.rho = rhoCtl.getMeanRho(numActive);
 	return *this;
 }
 
 MTContext& MTContext::parallelOMIPOptimization(Args& CLIArgs, double rhs) {
 	waitAllJobs();
 
-	for (size_t i{ 0 }; i < CLIArgs.numsubMIPs; i++) {
-		threads.emplace_back(&MTContext::OMIPInstanceJob, this, i, std::ref(CLIArgs), rhs);
+	double roundTime{ Clock::getTime() };
+	numActive = activeWorkers(DetBudget::Phase::OMIP);
+	coreSched.startPhase(numActive);
+	drawPolicies(DetBudget::Phase::OMIP, numActive, true);
+	if (deterministic)
+		for (size_t i{ 0 }; i < numActive; i++)
+			reservedArms[i] = detBudget.reserveArm(DetBudget::Phase::OMIP);
+
+	for (size_t i{ 0 }; i < numActive; i++) {
+		threads.emplace_back([this, i, &CLIArgs, rhs]() {
+			coreSched.pinWorker(i);
+			OMIPInstanceJob(i, CLIArgs, rhs);
+			coreSched.release(i);
+		});
 	}
 
 	waitAllJobs();
+	if (deterministic)
+		roundTime = commitPhaseResults();
+	else
+		roundTime = Clock::timeElapsed(roundTime);
+	elasticWorkers.endRound(DetBudget::Phase::OMIP, roundTime);
+	CLIArgs.rho = rhoCtl.getMeanRho(numActive);
 	return *this;
 }
 
+MTContext& MTContext::prepareNextPhase(Args& CLIArgs, DetBudget::Phase phase) {
+	waitAllJobs();
+
+	if (!CLIArgs.pipeline || bestACSIncumbent.slackSum >= CPX_INFBOUND)
+		return *this;
+
+	// Snapshot of the shared state: the caller keeps updating the incumbent during the merge
+	specIncumbent = bestACSIncumbent;
+	specVersion = A_IncumbentVersion;
+	preparedPhase = phase;
+	size_t numNext{ activeWorkers(phase) };
+	drawPolicies(phase, numNext, false);
+
+	for (size_t i{ 0 }; i < numNext; i++) {
+		threads.emplace_back([this, i, &CLIArgs]() {
+			coreSched.pinWorker(i);
+			prepareSubMIP(i, CLIArgs, rhoCtl.getRho(i));
+		});
+	}
+
+#if ACS_VERBOSE >= VERBOSE
+	PRINT_INFO("MT Context: Preparing the next %s phase", DetBudget::phaseName(phase));
+#endif
+	return *this;
+}
+
+int MTContext::solveSubMIP(const size_t thID, MIP& model, const double detTimeLimit, Args& CLIArgs, double& usedTicks) {
+	size_t numCores{ deterministic ? coreSched.getPhaseShare(thID) : coreSched.getShare(thID) };
+	model.setNumCores(numCores);
+	if (coreSched.isPinned())
+		model.setCPUMask(coreSched.getCPUSet(thID, numCores));
+
+	// Deterministic mode: fixed threads for the whole solve, no rebalancing
+	if (deterministic) {
+		model.setDeterministic();
+		int solveCode{ model.solve(Clock::timeRemaining(CLIArgs.timeLimit), detTimeLimit) };
+		usedTicks = model.getLastDetTime();
+		return solveCode;
+	}
+
+	int solveCode;
+	usedTicks = 0.0;
+	do {
+		double slice{ std::min(detTimeLimit - usedTicks, std::max(MIN_DET_TL, detTimeLimit / CORE_SCHED_SLICES)) };
+		solveCode = model.solve(Clock::timeRemaining(CLIArgs.timeLimit), slice);
+		usedTicks += model.getLastDetTime();
+
+		if (solveCode != CPXMIP_DETTIME_LIM_FEAS && solveCode != CPXMIP_DETTIME_LIM_INFEAS)
+			break;
+		if (detTimeLimit - usedTicks < EPSILON || Clock::timeRemaining(CLIArgs.timeLimit) < EPSILON)
+			break;
+
+		// Resume the search with the cores freed by the workers that already finished
+		size_t newNumCores{ coreSched.getShare(thID) };
+		if (newNumCores != numCores) {
+			numCores = newNumCores;
+			model.setNumCores(numCores);
+			if (coreSched.isPinned())
+				model.setCPUMask(coreSched.getCPUSet(thID, numCores));
+#if ACS_VERBOSE >= VERBOSE
+			PRINT_INFO("Proc: %3d - CoreScheduler - Resuming with %zu cores", thID, numCores);
+#endif
+		}
+	} while (true);
+
+	return solveCode;
+}
+
 MTContext::~MTContext() {
+	waitAllJobs();
 #if ACS_VERBOSE >= VERBOSE
 	PRINT_INFO("MT Context: Closed");
 #endif
@@ -94,14 +319,9 @@ MTContext::~MTContext() {
 
 void MTContext::FMIPInstanceJob(const size_t thID, Args& CLIArgs) {
 
-	FMIP fMIP{ CLIArgs.fileName };
-	if (bestACSIncumbent.slackSum < CPX_INFBOUND) {
-		fMIP.addMIPStart(bestACSIncumbent.sol);
-		FixPolicy::fixSlackUpperBoundMT(thID, "FMIP", fMIP, bestACSIncumbent.sol);
-	}
-	fMIP.setNumCores(CPLEX_CORE);
-
-	FixPolicy::randomRhoFixMT(thID, "FMIP", fMIP, tmpSolutions[thID].sol, CLIArgs.rho, rndGens[thID]);
+	std::unique_ptr<MIP> subMIP{ takeSubMIP(thID, DetBudget::Phase::FMIP, CLIArgs) };
+	FMIP&				 fMIP{ static_cast<FMIP&>(*subMIP) };
+	setFMIPObjLimits(fMIP);
 
 	/// FIXED: Bug #e15760bcfd3dcca51cf9ea23f70072dd6cb2ac14 — Resolved MIPException::WrongTimeLimit triggered by a negligible time limit.
 	if (Clock::timeRemaining(CLIArgs.timeLimit) < EPSILON) {
@@ -111,39 +331,239 @@ void MTContext::FMIPInstanceJob(const size_t thID, Args& CLIArgs) {
 		return;
 	}
 
-	int solveCode{ fMIP.solve(Clock::timeRemaining(CLIArgs.timeLimit), DET_TL(fMIP.getNumNonZeros())) };
+	Solution		  refSol{ .sol = std::vector<double>(), .slackSum = bestACSIncumbent.slackSum, .oMIPCost = bestACSIncumbent.oMIPCost };
+	DetBudget::Budget budget{ deterministic ? detBudget.getBudget(DetBudget::Phase::FMIP, reservedArms[thID], fMIP.getNumNonZeros(), Clock::timeRemaining(CLIArgs.timeLimit))
+											: detBudget.getBudget(DetBudget::Phase::FMIP, fMIP.getNumNonZeros(), Clock::timeRemaining(CLIArgs.timeLimit)) };
+	uint64_t signature{ 0 };
+	size_t	 version{ 0 };
+	bool	 screened{ screenSubMIP(thID, DetBudget::Phase::FMIP, fMIP, budget.detTL, signature, version) };
+	// Only now: the redraws of screenSubMIP compare the reference with the one of the previous subMIP
+	prevRefs[thID] = tmpSolutions[thID].sol;
+	if (!screened)
+		return;
+	double solveTime{ Clock::getTime() };
+
+	double usedTicks{ 0.0 };
+	int	   solveCode{ solveSubMIP(thID, fMIP, budget.detTL, CLIArgs, usedTicks) };
+	solveTime = Clock::timeElapsed(solveTime);
+	A_NumSubMIPs++;
+	addPhaseTimes(DetBudget::Phase::FMIP, 0.0, solveTime);
+
+	WorkerResult result{ .pending = true, .phase = DetBudget::Phase::FMIP, .budget = budget, .solveCode = solveCode, .ticks = usedTicks, .solveTime = solveTime, .improvement = 0.0, .nnz = fMIP.getNumNonZeros(), .cutoff = fMIP.hasCutoff(), .policy = workerPolicies[thID], .fixTime = fixTimes[thID], .signature = signature, .version = version };
 
 	if (MIP::isINForUNBD(solveCode)) {
 #if ACS_VERBOSE >= VERBOSE
 		PRINT_INFO("Proc: %3d [FMIP] - Aborted: Infeasible with given TL [%d]", thID, solveCode);
 #endif
-		return;
+	} else {
+		tmpSolutions[thID].sol = fMIP.getSol();
+		tmpSolutions[thID].slackSum = fMIP.getObjValue();
+		/// FIXED: Bug #9d6c973e040c2a8da57051d05e46d92c6e366c45 -- Inconsistency between actual and saved objective values due to incorrect slack sum comparison
+		tmpSolutions[thID].oMIPCost = fMIP.getOMIPCost(tmpSolutions[thID].sol);
+
+		PRINT_OUT("Proc: %3d - FeasMIP Objective: %20.2f", thID, tmpSolutions[thID].slackSum);
+		result.improvement = DetBudget::improvement(refSol, tmpSolutions[thID]);
 	}
 
-	tmpSolutions[thID].sol = fMIP.getSol();
-	tmpSolutions[thID].slackSum = fMIP.getObjValue();
-	/// FIXED: Bug #9d6c973e040c2a8da57051d05e46d92c6e366c45 -- Inconsistency between actual and saved objective values due to incorrect slack sum comparison
-	tmpSolutions[thID].oMIPCost = fMIP.getOMIPCost(tmpSolutions[thID].sol);
+	// Deterministic mode: the outcome is committed at the end of the phase, in worker order
+	if (deterministic)
+		results[thID] = result;
+	else
+		commitWorkerResult(thID, result);
+}
+
+#pragma region MTContextPrivateSec
+
+size_t MTContext::activeWorkers(DetBudget::Phase phase) {
+	size_t numWorkers{ elasticWorkers.getNumActive(phase) };
+	if (numWorkers > numMIPs)
+		throw ACSException(ACSException::ExceptionType::OutOfBound, "Active workers exceed the worker slots", "MTContext");
+	return numWorkers;
+}
+
+void MTContext::commitWorkerResult(const size_t thID, const WorkerResult& result) {
+	const char* type{ DetBudget::phaseName(result.phase) };
+
+	detBudget.record(result.phase, thID, result.budget, result.ticks, result.solveTime, result.solveCode, result.improvement);
+	elasticWorkers.record(result.phase, MIP::isTimeLimit(result.solveCode), result.improvement, result.nnz);
+	policyPortfolio.record(result.phase, result.policy, result.improvement, result.fixTime + result.solveTime, result.ticks, MIP::isINForUNBD(result.solveCode));
+
+	if (nbhCache.isEnabled()) {
+		double value{ CPX_INFBOUND };
+		if (!MIP::isINForUNBD(result.solveCode))
+			value = (result.phase == DetBudget::Phase::FMIP) ? tmpSolutions[thID].slackSum : tmpSolutions[thID].oMIPCost;
+		nbhCache.record(result.signature, result.version, result.solveCode, result.cutoff, value, result.ticks);
+	}
+
+	if (MIP::isINForUNBD(result.solveCode)) {
+		if (result.cutoff) {
+			A_NumCutoffSubMIPs++;
+			rhoCtl.record(thID, type, MIP::cutoffSolveCode(result.solveCode), result.improvement);
+		}
+		return;
+	}
 
-	PRINT_OUT("Proc: %3d - FeasMIP Objective: %20.2f", thID, tmpSolutions[thID].slackSum);
 	setBestACSIncumbent(tmpSolutions[thID]);
+	elitePool.insert(tmpSolutions[thID]);
+	rhoCtl.record(thID, type, result.solveCode, result.improvement);
+}
 
-	FixPolicy::dynamicAdjustRhoMT(thID, "FMIP", solveCode, numMIPs, CLIArgs.rho, A_RhoChanges);
+double MTContext::commitPhaseResults() {
+	double roundTicks{ 0.0 };
+
+	for (size_t i{ 0 }; i < numActive; i++) {
+		if (!results[i].pending)
+			continue;
+		commitWorkerResult(i, results[i]);
+		roundTicks = std::max(roundTicks, results[i].ticks);
+		results[i].pending = false;
+	}
+
+	return roundTicks;
 }
 
-#pragma region MTContextPrivateSec
+void MTContext::drawPolicies(DetBudget::Phase phase, size_t numWorkers, bool keepPrepared) {
+	const size_t numBlocks{ FixPolicy::getBlocks().vars.size() };
 
-void MTContext::OMIPInstanceJob(const size_t thID, Args& CLIArgs, double rhs) {
+	for (size_t i{ 0 }; i < numWorkers; i++) {
+		if (keepPrepared && prepared[i].model && preparedPhase == phase) {
+			workerPolicies[i] = prepared[i].policy;
+			workerBlocks[i] = prepared[i].block;
+			continue;
+		}
+		workerPolicies[i] = policyPortfolio.pick(phase);
+		workerBlocks[i] = (workerPolicies[i] == PolicyPortfolio::Policy::Block) ? static_cast<int>(blockCursor++ % numBlocks) : -1;
+	}
+}
 
-	OMIP oMIP{ CLIArgs.fileName };
-	if (bestACSIncumbent.slackSum < CPX_INFBOUND) {
-		oMIP.addMIPStart(bestACSIncumbent.sol);
-		FixPolicy::fixSlackUpperBoundMT(thID, "OMIP", oMIP, bestACSIncumbent.sol);
+void MTContext::fixSubMIP(const size_t thID, const char* type, MIP& model, const Solution& incumbent, const std::vector<double>& refSol, double rho, PolicyPortfolio::Policy policy, Random& rnd) {
+	double fixTime{ Clock::getTime() };
+
+	if (incumbent.slackSum < CPX_INFBOUND) {
+		model.addMIPStart(incumbent.sol);
+		FixPolicy::fixSlackUpperBoundMT(thID, type, model, incumbent.sol);
+	}
+
+	PolicyPortfolio::apply(policy, thID, type, model, refSol, prevRefs[thID], rho, static_cast<size_t>(std::max(workerBlocks[thID], 0)), rnd);
+	fixTimes[thID] = Clock::timeElapsed(fixTime);
+}
+
+void MTContext::prepareSubMIP(const size_t thID, Args& CLIArgs, double rho) {
+	double			prepTime{ Clock::getTime() };
+	PreparedSubMIP& prep{ prepared[thID] };
+
+	if (preparedPhase == DetBudget::Phase::FMIP)
+		prep.model = std::make_unique<FMIP>(CLIArgs.fileName);
+	else
+		prep.model = std::make_unique<OMIP>(CLIArgs.fileName);
+	prep.model->startBoundJournal();
+
+	// The incumbent is what gets broadcast when the merge does not improve it
+	prep.rnd = rndGens[thID];
+	prep.rho = rho;
+	prep.policy = workerPolicies[thID];
+	prep.block = workerBlocks[thID];
+	fixSubMIP(thID, DetBudget::phaseName(preparedPhase), *prep.model, specIncumbent, specIncumbent.sol, rho, prep.policy, rndGens[thID]);
+
+	std::lock_guard<std::mutex> lock(timesMTX);
+	phaseTimes[static_cast<size_t>(preparedPhase)].hidden += Clock::timeElapsed(prepTime);
+	phaseTimes[static_cast<size_t>(preparedPhase)].prepared++;
+}
+
+std::unique_ptr<MIP> MTContext::takeSubMIP(const size_t thID, DetBudget::Phase phase, Args& CLIArgs) {
+	double				 setupTime{ Clock::getTime() };
+	const char*			 type{ DetBudget::phaseName(phase) };
+	PreparedSubMIP&		 prep{ prepared[thID] };
+	std::unique_ptr<MIP> model{ std::move(prep.model) };
+
+	if (model && preparedPhase != phase) {
+		std::lock_guard<std::mutex> lock(timesMTX);
+		phaseTimes[static_cast<size_t>(preparedPhase)].discarded++;
+		model.reset();
+	}
+
+	if (!model) {
+		if (phase == DetBudget::Phase::FMIP)
+			model = std::make_unique<FMIP>(CLIArgs.fileName);
+		else
+			model = std::make_unique<OMIP>(CLIArgs.fileName);
+		// Screened fixings are redrawn from the unfixed bounds
+		if (nbhCache.isEnabled() || propagator)
+			model->startBoundJournal();
+		fixSubMIP(thID, type, *model, bestACSIncumbent, tmpSolutions[thID].sol, rhoCtl.getRho(thID), workerPolicies[thID], rndGens[thID]);
+
+		std::lock_guard<std::mutex> lock(timesMTX);
+		phaseTimes[static_cast<size_t>(phase)].setup += Clock::timeElapsed(setupTime);
+		return model;
 	}
-	oMIP.setNumCores(CPLEX_CORE);
-	// oMIP.updateBudgetConstr(rhs);			v1.2.11 -- no need of this
 
-	FixPolicy::randomRhoFixMT(thID, "OMIP", oMIP, tmpSolutions[thID].sol, CLIArgs.rho, rndGens[thID]);
+	// Speculation failed: undo the fixings and redo them with the same random draws
+	if (A_IncumbentVersion != specVersion || tmpSolutions[thID].sol != specIncumbent.sol || std::abs(rhoCtl.getRho(thID) - prep.rho) > EPSILON) {
+		model->restoreBounds();
+		model->deleteMIPStarts();
+		rndGens[thID] = prep.rnd;
+		fixSubMIP(thID, type, *model, bestACSIncumbent, tmpSolutions[thID].sol, rhoCtl.getRho(thID), workerPolicies[thID], rndGens[thID]);
+
+		std::lock_guard<std::mutex> lock(timesMTX);
+		phaseTimes[static_cast<size_t>(phase)].refresh += Clock::timeElapsed(setupTime);
+		phaseTimes[static_cast<size_t>(phase)].refreshed++;
+#if ACS_VERBOSE >= VERBOSE
+		PRINT_INFO("Proc: %3d [%s] - Prepared subMIP refreshed", thID, type);
+#endif
+	}
+	return model;
+}
+
+bool MTContext::screenSubMIP(const size_t thID, DetBudget::Phase phase, MIP& model, const double detTimeLimit, uint64_t& signature, size_t& version) {
+	if (!nbhCache.isEnabled() && !propagator)
+		return true;
+
+	const char* type{ DetBudget::phaseName(phase) };
+	for (size_t attempt{ 0 };; attempt++) {
+		bool infeasible{ false };
+		if (propagator) {
+			Propagator::Result prop{ propagator->propagate(model) };
+			infeasible = prop.infeasible;
+#if ACS_VERBOSE >= VERBOSE
+			if (infeasible)
+				PRINT_INFO("Proc: %3d [%s] - Propagator - Infeasible fixing (constraint %d)", thID, type, prop.conflictRow);
+			else
+				PRINT_INFO("Proc: %3d [%s] - Propagator - %zu bounds tightened", thID, type, prop.tightened);
+#endif
+		}
+
+		if (!infeasible && nbhCache.isEnabled()) {
+			version = A_IncumbentVersion;
+			signature = NeighborhoodCache::signature(model, phase, version);
+			if (!nbhCache.isUnproductive(signature, version, detTimeLimit))
+				return true;
+		} else if (!infeasible)
+			return true;
+
+		if (attempt == (infeasible ? PROP_RETRIES : NBH_CACHE_RETRIES)) {
+			if (!infeasible)
+				nbhCache.countSkipped();
+#if ACS_VERBOSE >= VERBOSE
+			PRINT_INFO("Proc: %3d [%s] - %s, solve skipped", thID, type, infeasible ? "Infeasible fixing" : "Known neighborhood");
+#endif
+			return false;
+		}
+
+		// Same policy and rho, new random draws
+		model.restoreBounds();
+		model.deleteMIPStarts();
+		fixSubMIP(thID, type, model, bestACSIncumbent, tmpSolutions[thID].sol, rhoCtl.getRho(thID), workerPolicies[thID], rndGens[thID]);
+		if (!infeasible)
+			nbhCache.countPerturbed();
+	}
+}
+
+void MTContext::OMIPInstanceJob(const size_t thID, Args& CLIArgs, double rhs) {
+
+	std::unique_ptr<MIP> subMIP{ takeSubMIP(thID, DetBudget::Phase::OMIP, CLIArgs) };
+	OMIP&				 oMIP{ static_cast<OMIP&>(*subMIP) };
+	setOMIPObjLimits(oMIP);
+	// oMIP.updateBudgetConstr(rhs);			v1.2.11 -- no need of this
 
 	/// FIXED: Bug #e15760bcfd3dcca51cf9ea23f70072dd6cb2ac14 — Resolved MIPException::WrongTimeLimit triggered by a negligible time limit.
 	if (Clock::timeRemaining(CLIArgs.timeLimit) < EPSILON) {
@@ -153,22 +573,44 @@ void MTContext::OMIPInstanceJob(const size_t thID, Args& CLIArgs, double rhs) {
 		return;
 	}
 
-	int solveCode{ oMIP.solve(Clock::timeRemaining(CLIArgs.timeLimit), DET_TL(oMIP.getNumNonZeros())) };
+	Solution		  refSol{ .sol = std::vector<double>(), .slackSum = bestACSIncumbent.slackSum, .oMIPCost = bestACSIncumbent.oMIPCost };
+	DetBudget::Budget budget{ deterministic ? detBudget.getBudget(DetBudget::Phase::OMIP, reservedArms[thID], oMIP.getNumNonZeros(), Clock::timeRemaining(CLIArgs.timeLimit))
+											: detBudget.getBudget(DetBudget::Phase::OMIP, oMIP.getNumNonZeros(), Clock::timeRemaining(CLIArgs.timeLimit)) };
+	uint64_t signature{ 0 };
+	size_t	 version{ 0 };
+	bool	 screened{ screenSubMIP(thID, DetBudget::Phase::OMIP, oMIP, budget.detTL, signature, version) };
+	// Only now: the redraws of screenSubMIP compare the reference with the one of the previous subMIP
+	prevRefs[thID] = tmpSolutions[thID].sol;
+	if (!screened)
+		return;
+	double solveTime{ Clock::getTime() };
+
+	double usedTicks{ 0.0 };
+	int	   solveCode{ solveSubMIP(thID, oMIP, budget.detTL, CLIArgs, usedTicks) };
+	solveTime = Clock::timeElapsed(solveTime);
+	A_NumSubMIPs++;
+	addPhaseTimes(DetBudget::Phase::OMIP, 0.0, solveTime);
+
+	WorkerResult result{ .pending = true, .phase = DetBudget::Phase::OMIP, .budget = budget, .solveCode = solveCode, .ticks = usedTicks, .solveTime = solveTime, .improvement = 0.0, .nnz = oMIP.getNumNonZeros(), .cutoff = oMIP.hasCutoff(), .policy = workerPolicies[thID], .fixTime = fixTimes[thID], .signature = signature, .version = version };
+
 	if (MIP::isINForUNBD(solveCode)) {
 #if ACS_VERBOSE >= VERBOSE
 		PRINT_INFO("Proc: %3d [OMIP] - Aborted: Infeasible with given TL [%d]", thID, solveCode);
 #endif
-		return;
-	}
+	} else {
+		tmpSolutions[thID].sol = oMIP.getSol();
+		tmpSolutions[thID].slackSum = oMIP.getSlackSum();
+		tmpSolutions[thID].oMIPCost = oMIP.getObjValue();
 
-	tmpSolutions[thID].sol = oMIP.getSol();
-	tmpSolutions[thID].slackSum = oMIP.getSlackSum();
-	tmpSolutions[thID].oMIPCost = oMIP.getObjValue();
-
-	PRINT_OUT("Proc: %3d - OptMIP Objective: %20.2f|%-10.2f", thID, tmpSolutions[thID].oMIPCost, tmpSolutions[thID].slackSum);
-	setBestACSIncumbent(tmpSolutions[thID]);
+		PRINT_OUT("Proc: %3d - OptMIP Objective: %20.2f|%-10.2f", thID, tmpSolutions[thID].oMIPCost, tmpSolutions[thID].slackSum);
+		result.improvement = DetBudget::improvement(refSol, tmpSolutions[thID]);
+	}
 
-	FixPolicy::dynamicAdjustRhoMT(thID, "OMIP", solveCode, numMIPs, CLIArgs.rho, A_RhoChanges);
+	// Deterministic mode: the outcome is committed at the end of the phase, in worker order
+	if (deterministic)
+		results[thID] = result;
+	else
+		commitWorkerResult(thID, result);
 }
 
 #pragma endregion
\ No newline at end of file
@@ -1,11 +1,15 @@
 #include "../include/MergePolicy.hpp"
+#include "../include/FixPolicy.hpp"
 
 using MPEx = MergePolicy::MergePolicyException::ExceptionType;
 
-void MergePolicy::recombine(MIP& model, const std::vector<Solution>& x, const char* phase) {
-	if (x.empty())
+void MergePolicy::recombine(MIP& model, std::span<const Solution> x, const char* phase, std::span<const Solution> extra) {
+	const size_t numSols{ x.size() + extra.size() };
+	if (!numSols)
 		throw MergePolicyException(MPEx::InputSizeError, "Empty vector passed to function");
 
+	auto solAt = [&](size_t p) -> const std::vector<double>& { return (p < x.size()) ? x[p].sol : extra[p - x.size()].sol; };
+
 #if ACS_VERBOSE >= VERBOSE
 	size_t numCommVars{ 0 };
 #endif
@@ -13,18 +17,18 @@ void MergePolicy::recombine(MIP& model, const std::vector<Solution>& x, const ch
 	size_t xLen { model.getMIPNumVars()};
 
 	for (size_t i{ 0 }; i < xLen; i++) {
-		if (std::abs(x[0].sol[i] - x[1].sol[i]) >= EPSILON)
+		if (numSols > 1 && std::abs(solAt(0)[i] - solAt(1)[i]) >= EPSILON)
 			continue;
 
 		bool commonValue{ true };
-		for (size_t p{ 0 }; p < x.size() - 1; p++) {
-			if (std::abs(x[p].sol[i] - x[p + 1].sol[i]) >= EPSILON) {
+		for (size_t p{ 0 }; p < numSols - 1; p++) {
+			if (std::abs(solAt(p)[i] - solAt(p + 1)[i]) >= EPSILON) {
 				commonValue = false;
 				break;
 			}
 		}
 		if (commonValue) {
-			model.setVarValue(i, x[0].sol[i]);
+			model.setVarValue(i, solAt(0)[i]);
 #if ACS_VERBOSE >= VERBOSE
 			numCommVars++;
 #endif
@@ -34,4 +38,39 @@ void MergePolicy::recombine(MIP& model, const std::vector<Solution>& x, const ch
 #if ACS_VERBOSE >= VERBOSE
 	PRINT_INFO("[%s] - MergePolicy::recombine - %zu common vars", phase, numCommVars);
 #endif
+}
+
+size_t MergePolicy::stitchBlocks(MIP& model, const std::vector<double>& base, std::span<const Solution> x, std::span<const int> blocks, const char* phase) {
+	const auto& blockVars{ FixPolicy::getBlocks().vars };
+	if (x.size() != blocks.size())
+		throw MergePolicyException(MPEx::InputSizeError, "Solutions and blocks of different size");
+	if (base.size() < model.getMIPNumVars() || blockVars.empty())
+		return 0;
+
+	// Best solution (slack sum, then cost) of each block
+	std::vector<int> bestOf(blockVars.size(), -1);
+	for (size_t p{ 0 }; p < x.size(); p++) {
+		if (blocks[p] < 0 || x[p].sol.empty())
+			continue;
+		int& best{ bestOf[blocks[p]] };
+		if (best < 0 || x[p].slackSum < x[best].slackSum - EPSILON || (std::abs(x[p].slackSum - x[best].slackSum) < EPSILON && x[p].oMIPCost < x[best].oMIPCost))
+			best = static_cast<int>(p);
+	}
+
+	std::vector<double> stitched(base.begin(), base.begin() + model.getMIPNumVars());
+	size_t				numStitched{ 0 };
+	for (size_t b{ 0 }; b < blockVars.size(); b++) {
+		if (bestOf[b] < 0)
+			continue;
+		for (int v : blockVars[b])
+			stitched[v] = x[bestOf[b]].sol[v];
+		numStitched++;
+	}
+
+	if (numStitched)
+		model.addMIPVarsStart(stitched);
+#if ACS_VERBOSE >= VERBOSE
+	PRINT_INFO("[%s] - MergePolicy::stitchBlocks - %zu blocks stitched", phase, numStitched);
+#endif
+	return numStitched;
 }
\ No newline at end of file
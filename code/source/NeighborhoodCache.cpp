@@ -0,0 +1,100 @@
+#include "../include/NeighborhoodCache.hpp"
+
+NeighborhoodCache::NeighborhoodCache(bool enabled) : enabled{ enabled }, version{ 0 } {
+	stats = { .lookups = 0, .hits = {}, .perturbed = 0, .skipped = 0, .records = 0 };
+}
+
+uint64_t NeighborhoodCache::signature(MIP& model, DetBudget::Phase phase, size_t version) {
+	std::vector<double> lb, ub;
+	model.getBounds(lb, ub);
+	size_t numMIPVars{ model.getMIPNumVars() };
+
+	uint64_t h{ Hash::mix(Hash::OFFSET, static_cast<uint64_t>(phase)) };
+	h = Hash::mix(h, static_cast<uint64_t>(version));
+
+	// Fixed MIP variables, then the slack upper bounds set from the incumbent
+	for (size_t j{ 0 }; j < numMIPVars; j++) {
+		if (ub[j] - lb[j] >= EPSILON)
+			continue;
+		h = Hash::mix(h, static_cast<uint64_t>(j));
+		h = Hash::mix(h, lb[j], NBH_CACHE_HASH_GRID);
+	}
+	for (size_t j{ numMIPVars }; j < ub.size(); j++)
+		h = Hash::mix(h, ub[j], NBH_CACHE_HASH_GRID);
+	// Rows added by the fixing (e.g. local branching)
+	return Hash::mix(h, model.getJournalRowsKey());
+}
+
+bool NeighborhoodCache::isUnproductive(uint64_t key, size_t version, double detTimeLimit) {
+	if (!enabled)
+		return false;
+
+	std::lock_guard<std::mutex> lock(cacheMTX);
+	stats.lookups++;
+	if (!syncVersion(version))
+		return false;
+
+	auto it{ entries.find(key) };
+	if (it == entries.end())
+		return false;
+
+	// A limit-reached neighborhood is worth a solve only with a larger budget
+	const Entry& entry{ it->second };
+	if (entry.outcome == Outcome::Limit && detTimeLimit > entry.ticks + EPSILON)
+		return false;
+
+	stats.hits[static_cast<size_t>(entry.outcome)]++;
+	return true;
+}
+
+void NeighborhoodCache::record(uint64_t key, size_t version, int solveCode, bool cutoff, double value, double ticks) {
+	if (!enabled)
+		return;
+
+	Entry entry{ .outcome = Outcome::Limit, .value = value, .ticks = ticks };
+	int	  code{ cutoff ? MIP::cutoffSolveCode(solveCode) : solveCode };
+	if (MIP::isTimeLimit(code))
+		entry.outcome = Outcome::Limit;
+	else if (MIP::isINForUNBD(code) || code == MIP_NO_IMPROVEMENT)
+		entry.outcome = Outcome::Infeasible;
+	else if (code == CPXMIP_OPTIMAL || code == CPXMIP_OPTIMAL_TOL)
+		entry.outcome = Outcome::Optimal;
+	else
+		return;
+
+	std::lock_guard<std::mutex> lock(cacheMTX);
+	if (!syncVersion(version))
+		return;
+	if (entries.size() >= NBH_CACHE_MAX_ENTRIES)
+		entries.clear();
+
+	// Keep the largest budget a limit-reached neighborhood was given
+	auto [it, inserted] = entries.try_emplace(key, entry);
+	if (!inserted && !(it->second.outcome == Outcome::Limit && entry.outcome == Outcome::Limit && entry.ticks < it->second.ticks))
+		it->second = entry;
+	stats.records++;
+}
+
+void NeighborhoodCache::countPerturbed() {
+	std::lock_guard<std::mutex> lock(cacheMTX);
+	stats.perturbed++;
+}
+
+void NeighborhoodCache::countSkipped() {
+	std::lock_guard<std::mutex> lock(cacheMTX);
+	stats.skipped++;
+}
+
+#pragma region NeighborhoodCachePrivateSec
+
+bool NeighborhoodCache::syncVersion(size_t newVersion) {
+	if (newVersion < version)
+		return false;
+	if (newVersion > version) {
+		entries.clear();
+		version = newVersion;
+	}
+	return true;
+}
+
+#pragma endregion
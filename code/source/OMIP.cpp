@@ -45,13 +45,7 @@ double OMIP::getSlackSum() {
 }
 
 void OMIP::setup() {
-	for (size_t i{ 0 }; i < getNumRows(); i++) {
-		addCol(i, 1, OMIP_SLACK_OBJ_COEFF, 0.0, CPX_INFBOUND, "SP_" + std::to_string(i + 1));
-	}
-
-	for (size_t i{ 0 }; i < getNumRows(); i++) {
-		addCol(i, -1, OMIP_SLACK_OBJ_COEFF, 0.0, CPX_INFBOUND, "SN_" + std::to_string(i + 1));
-	}
+	addSlackCols(OMIP_SLACK_OBJ_COEFF);
 
 	//addBudgetConstr(CPX_INFBOUND);	Not necessary
 }
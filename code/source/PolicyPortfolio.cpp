@@ -0,0 +1,101 @@
+#include "../include/PolicyPortfolio.hpp"
+#include "../include/FixPolicy.hpp"
+
+/// Walk probability of the WalkMIP policy
+static double walkProb{ DEF_WALK_PROB };
+
+PolicyPortfolio::PolicyPortfolio(bool enabled, bool deterministic, size_t fixed) : enabled{ enabled }, fixed{ static_cast<Policy>(fixed) }, deterministic{ deterministic } {
+	if (fixed >= NUM_POLICIES)
+		throw ACSException(ACSException::ExceptionType::WrongArgsValue, "Unknown fixing policy " + std::to_string(fixed), "PolicyPortfolio");
+
+	for (auto& phaseStats : stats)
+		phaseStats.fill({ .picks = 0, .solves = 0, .improvement = 0.0, .cost = 0.0, .ticks = 0.0, .infeasible = 0 });
+}
+
+PolicyPortfolio::Policy PolicyPortfolio::pick(DetBudget::Phase phase) {
+	std::lock_guard<std::mutex> lock(portfolioMTX);
+	auto&						policies{ stats[static_cast<size_t>(phase)] };
+
+	if (!enabled) {
+		Policy policy{ isAvailable(phase, fixed) ? fixed : Policy::RandomRho };
+		policies[static_cast<size_t>(policy)].picks++;
+		return policy;
+	}
+
+	// Policies never tried are given in order (the ACS default first)
+	std::vector<UCB::Arm> arms;
+	arms.reserve(NUM_POLICIES);
+	for (size_t p{ 0 }; p < NUM_POLICIES; p++)
+		arms.push_back({ .picks = policies[p].picks, .solves = policies[p].solves, .gain = policies[p].improvement, .cost = policies[p].cost, .available = isAvailable(phase, static_cast<Policy>(p)) });
+
+	size_t bestPolicy{ UCB::pick(arms, PORTFOLIO_UCB_C) };
+	policies[bestPolicy].picks++;
+	return static_cast<Policy>(bestPolicy);
+}
+
+void PolicyPortfolio::record(DetBudget::Phase phase, Policy policy, double improvement, double wallTime, double ticks, bool infeasible) {
+	std::lock_guard<std::mutex> lock(portfolioMTX);
+	PolicyStats&				st{ stats[static_cast<size_t>(phase)][static_cast<size_t>(policy)] };
+
+	st.solves++;
+	st.improvement += improvement;
+	st.cost += deterministic ? ticks : wallTime;
+	st.ticks += ticks;
+	st.infeasible += infeasible;
+}
+
+bool PolicyPortfolio::isAvailable(DetBudget::Phase phase, Policy policy) {
+	if (policy == Policy::WalkMIP)
+		return phase == DetBudget::Phase::FMIP;
+	if (isLPGuided(policy))
+		return !FixPolicy::getRootLP().x.empty();
+	if (policy == Policy::Block)
+		return FixPolicy::getBlocks().vars.size() > 1;
+	return true;
+}
+
+void PolicyPortfolio::apply(Policy policy, const size_t thID, const char* type, MIP& model, const std::vector<double>& refSol, const std::vector<double>& prevRefSol, double rho, size_t block, Random& rnd) {
+	switch (policy) {
+		case Policy::UniformRho:
+			FixPolicy::uniformRhoFixMT(thID, type, model, refSol, rho, rnd);
+			break;
+
+		case Policy::WalkMIP:
+			FixPolicy::walkMIPMT(thID, type, model, refSol, rho, walkProb, rnd);
+			break;
+
+		case Policy::GraphBFS:
+			FixPolicy::graphBFSFixMT(thID, type, model, refSol, prevRefSol, rho, rnd);
+			break;
+
+		case Policy::GraphWalk:
+			FixPolicy::graphWalkFixMT(thID, type, model, refSol, prevRefSol, rho, rnd);
+			break;
+
+		case Policy::RINS:
+			FixPolicy::rinsFixMT(thID, type, model, refSol, rho, rnd);
+			break;
+
+		case Policy::RedCost:
+			FixPolicy::redCostFixMT(thID, type, model, refSol, rho, rnd);
+			break;
+
+		case Policy::Block:
+			FixPolicy::blockFixMT(thID, type, model, refSol, block, rho, rnd);
+			break;
+
+		case Policy::LocalBranch:
+			FixPolicy::localBranchMT(thID, type, model, refSol, rho, rnd);
+			break;
+
+		default:
+			FixPolicy::randomRhoFixMT(thID, type, model, refSol, rho, rnd);
+			break;
+	}
+}
+
+void PolicyPortfolio::setWalkProb(double p) {
+	if (p < EPSILON || p >= 1.0)
+		throw ACSException(ACSException::ExceptionType::WrongArgsValue, "WalkProb par. must be within (0,1)!", "PolicyPortfolio");
+	walkProb = p;
+}
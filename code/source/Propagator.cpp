@@ -0,0 +1,181 @@
+#include "../include/Propagator.hpp"
+
+#define LE 'L'
+#define EQ 'E'
+#define GE 'G'
+
+Propagator::Propagator(const std::string& fileName) : Propagator(MIP(fileName)) {}
+
+Propagator::Propagator(MIP&& model)
+	: numVars{ model.getMIPNumVars() },
+	  numRows{ model.getOgNumRows() },
+	  rowBeg{ model.getMIPRowBeg() },
+	  rowInd{ model.getMIPRowInd() },
+	  rowVal{ model.getMIPRowVal() },
+	  sense{ model.getMIPSense() },
+	  rhs{ model.getMIPRhs() },
+	  varToConstr{ model.getMIPVarToConstr() } {
+
+	isInt.assign(numVars, 0);
+	for (int j : model.getMIPIntVars())
+		isInt[j] = 1;
+}
+
+Propagator::Result Propagator::propagate(MIP& model) {
+	A_Runs++;
+	Result result{ .infeasible = false, .conflictRow = -1, .tightened = 0 };
+
+	std::vector<double> lb, ub;
+	model.getBounds(lb, ub);
+	const bool				  hasSlacks{ lb.size() >= numVars + 2 * numRows };
+	const std::vector<double> lb0(lb.begin(), lb.begin() + numVars);
+	const std::vector<double> ub0(ub.begin(), ub.begin() + numVars);
+
+	// FIFO of the constraints to process: all of them first, then those of the tightened variables
+	std::vector<size_t> queue(numRows);
+	std::iota(queue.begin(), queue.end(), 0);
+	std::vector<char> inQueue(numRows, 1);
+	size_t			  head{ 0 };
+	size_t			  work{ 0 };
+	const size_t	  maxWork{ PROP_WORK_FACTOR * (rowInd.size() + numRows) };
+
+	while (head < queue.size() && work < maxWork && !result.infeasible) {
+		size_t c{ queue[head++] };
+		inQueue[c] = 0;
+
+		int		 end{ (c == numRows - 1) ? static_cast<int>(rowInd.size()) : rowBeg[c + 1] };
+		Activity act{ activity(c, lb, ub, hasSlacks) };
+		work += end - rowBeg[c] + 1;
+
+		bool   le{ sense[c] == LE || sense[c] == EQ };
+		bool   ge{ sense[c] == GE || sense[c] == EQ };
+		double tol{ PROP_FEAS_TOL * std::max(1.0, std::abs(rhs[c])) };
+		if ((le && !act.minInf && act.min > rhs[c] + tol) || (ge && !act.maxInf && act.max < rhs[c] - tol)) {
+			result.infeasible = true;
+			result.conflictRow = static_cast<int>(c);
+			break;
+		}
+
+		// Bounds implied by the residual activity of the other entries (stale activities stay valid, only weaker)
+		for (int k{ rowBeg[c] }; k < end; k++) {
+			size_t j{ static_cast<size_t>(rowInd[k]) };
+			double a{ rowVal[k] };
+			if (ub[j] - lb[j] < PROP_INT_TOL || a == 0.0)
+				continue;
+
+			double newLB{ lb[j] }, newUB{ ub[j] };
+			if (le) {
+				double bnd{ (a > 0) ? lb[j] : ub[j] };
+				bool   inf{ std::abs(bnd) >= CPX_INFBOUND };
+				if (!act.minInf || (act.minInf == 1 && inf)) {
+					double v{ (rhs[c] - (act.min - (inf ? 0.0 : a * bnd))) / a };
+					if (a > 0)
+						newUB = std::min(newUB, v);
+					else
+						newLB = std::max(newLB, v);
+				}
+			}
+			if (ge) {
+				double bnd{ (a > 0) ? ub[j] : lb[j] };
+				bool   inf{ std::abs(bnd) >= CPX_INFBOUND };
+				if (!act.maxInf || (act.maxInf == 1 && inf)) {
+					double v{ (rhs[c] - (act.max - (inf ? 0.0 : a * bnd))) / a };
+					if (a > 0)
+						newLB = std::max(newLB, v);
+					else
+						newUB = std::min(newUB, v);
+				}
+			}
+
+			bool changed{ false };
+			if (isInt[j]) {
+				newLB = std::ceil(newLB - PROP_INT_TOL);
+				newUB = std::floor(newUB + PROP_INT_TOL);
+				if (newLB > lb[j] + 0.5) {
+					lb[j] = newLB;
+					changed = true;
+				}
+				if (newUB < ub[j] - 0.5) {
+					ub[j] = newUB;
+					changed = true;
+				}
+			} else {
+				if (newLB > lb[j] + PROP_MIN_TIGHTEN * std::max(1.0, std::abs(newLB))) {
+					lb[j] = newLB;
+					changed = true;
+				}
+				if (newUB < ub[j] - PROP_MIN_TIGHTEN * std::max(1.0, std::abs(newUB))) {
+					ub[j] = newUB;
+					changed = true;
+				}
+			}
+
+			if (lb[j] > ub[j] + PROP_INT_TOL * std::max(1.0, std::abs(lb[j]))) {
+				result.infeasible = true;
+				result.conflictRow = static_cast<int>(c);
+				break;
+			}
+			if (!changed)
+				continue;
+
+			for (int r : varToConstr[j]) {
+				if (!inQueue[r]) {
+					inQueue[r] = 1;
+					queue.push_back(r);
+				}
+			}
+		}
+	}
+
+	if (result.infeasible) {
+		A_Infeasible++;
+		return result;
+	}
+
+	// Only integer bounds reach CPLEX: rounded, they carry no numerical noise
+	std::vector<int>	indices;
+	std::vector<double> newLBs, newUBs;
+	for (size_t j{ 0 }; j < numVars; j++) {
+		if (isInt[j] && (lb[j] != lb0[j] || ub[j] != ub0[j])) {
+			indices.push_back(static_cast<int>(j));
+			newLBs.push_back(lb[j]);
+			newUBs.push_back(ub[j]);
+		}
+	}
+	model.setVarsBounds(indices, newLBs, newUBs);
+	result.tightened = indices.size();
+	A_Tightened += indices.size();
+	return result;
+}
+
+#pragma region PropagatorPrivateSec
+
+Propagator::Activity Propagator::activity(const size_t c, const std::vector<double>& lb, const std::vector<double>& ub, const bool hasSlacks) const {
+	Activity act{ .min = 0.0, .max = 0.0, .minInf = 0, .maxInf = 0 };
+
+	auto add = [&](const double a, const double l, const double u) {
+		double lo{ (a > 0) ? l : u };
+		double hi{ (a > 0) ? u : l };
+		if (std::abs(lo) >= CPX_INFBOUND)
+			act.minInf++;
+		else
+			act.min += a * lo;
+		if (std::abs(hi) >= CPX_INFBOUND)
+			act.maxInf++;
+		else
+			act.max += a * hi;
+	};
+
+	int end{ (c == numRows - 1) ? static_cast<int>(rowInd.size()) : rowBeg[c + 1] };
+	for (int k{ rowBeg[c] }; k < end; k++)
+		add(rowVal[k], lb[rowInd[k]], ub[rowInd[k]]);
+
+	// FMIP/OMIP: a.x + SP - SN
+	if (hasSlacks) {
+		add(1.0, lb[numVars + c], ub[numVars + c]);
+		add(-1.0, lb[numVars + numRows + c], ub[numVars + numRows + c]);
+	}
+	return act;
+}
+
+#pragma endregion
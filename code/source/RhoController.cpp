@@ -0,0 +1,75 @@
+#include "../include/RhoController.hpp"
+
+RhoController::RhoController(size_t numWorkers, double initRho) : workers(numWorkers) {
+	for (WorkerStats& worker : workers) {
+		worker.rho = std::clamp(initRho, MIN_RHO, MAX_RHO);
+		worker.step = RHO_STEP_INIT;
+		worker.lastMove = 0;
+		worker.solves = 0;
+		worker.complete = 0;
+		worker.noImprove = 0;
+		worker.limits = 0;
+	}
+}
+
+double RhoController::getMeanRho(size_t numWorkers) const {
+	numWorkers = std::min(numWorkers, workers.size());
+	if (!numWorkers)
+		return 0.0;
+
+	double sum{ 0.0 };
+	for (size_t i{ 0 }; i < numWorkers; i++)
+		sum += workers[i].rho.load(std::memory_order_relaxed);
+	return sum / numWorkers;
+}
+
+void RhoController::record(const size_t thID, [[maybe_unused]] const char* type, const int solveCode, const double improvement) {
+	WorkerStats& worker{ workers[thID] };
+	int			 move{ 0 };
+
+	switch (solveCode) {
+		case CPXMIP_OPTIMAL:
+		case CPXMIP_OPTIMAL_TOL:
+			worker.complete++;
+			move = -1;
+			break;
+
+		case MIP_NO_IMPROVEMENT:
+			worker.noImprove++;
+			move = -1;
+			break;
+
+		case CPXMIP_DETTIME_LIM_FEAS:
+		case CPXMIP_TIME_LIM_FEAS:
+			worker.limits++;
+			move = 1;
+			break;
+
+		default:
+#if ACS_VERBOSE >= VERBOSE
+			PRINT_ERR("Unexpected value for solvecode: %d", solveCode);
+#endif
+			return;
+	}
+	worker.solves++;
+
+	// The neighborhood size is right while it keeps improving
+	if (improvement > EPSILON)
+		move = 0;
+
+	double rho{ worker.rho.load(std::memory_order_relaxed) };
+	if (move) {
+		if (worker.lastMove)
+			worker.step = std::clamp(worker.step * ((move == worker.lastMove) ? RHO_STEP_GROW : RHO_STEP_SHRINK), RHO_STEP_MIN, RHO_STEP_MAX);
+		worker.lastMove = move;
+
+		// Balanced when RHO_TARGET of the solves complete: target * up == (1 - target) * down
+		rho += worker.step * ((move > 0) ? RHO_TARGET : -(1.0 - RHO_TARGET));
+		rho = std::clamp(rho, MIN_RHO, MAX_RHO);
+		worker.rho.store(rho, std::memory_order_relaxed);
+#if ACS_VERBOSE >= VERBOSE
+		PRINT_INFO("Proc: %3d [%s] - RhoController - Rho %s [%5.4f] (step %5.4f)", thID, type, (move > 0) ? "Increased" : "Decreased", rho, worker.step);
+#endif
+	}
+	worker.trajectory.push_back({ .time = Clock::timeElapsed(), .rho = rho, .move = move });
+}
@@ -2,7 +2,10 @@
 using MIPEx = MIPException::ExceptionType;
 
 RlxFMIP::RlxFMIP(std::string fileName) : FMIP(fileName) {
-	restoreVarType.reserve(getNumCols());
+	size_t numCols{ getNumCols() };
+	restoreVarType.resize(numCols, CPX_CONTINUOUS);
+	if (CPXgetprobtype(env, model) != CPXPROB_LP && CPXgetctype(env, model, restoreVarType.data(), 0, numCols - 1))
+		throw MIPException(MIPEx::GetFunction, "Unable to get the vars type!");
 #if ACS_VERBOSE == DEBUG
 	this->fileName += "_RlxFMIP";
 #endif
@@ -19,13 +22,24 @@ int RlxFMIP::solve(const double timeLimit, const double detTimeLimit) {
 	if (detTimeLimit < CPX_INFBOUND) [[likely]]
 		CPXsetdblparam(env, CPX_PARAM_DETTILIM, detTimeLimit);
 
-	for (size_t i{ 0 }; i < restoreVarType.size(); i++)
-		changeVarType(i, restoreVarType[i]);
-	changeProbType(CPXPROB_MILP);
+	if (relaxed) {
+		changeProbType(CPXPROB_MILP);
+		std::vector<int> indices(restoreVarType.size());
+		std::iota(indices.begin(), indices.end(), 0);
+		if (CPXchgctype(env, model, indices.size(), indices.data(), restoreVarType.data()))
+			throw MIPException(MIPEx::SetFunction, "Vars type not restored!");
+		relaxed = false;
+	}
+
+	double startDetTime{ 0.0 }, endDetTime{ 0.0 };
+	CPXgetdettime(env, &startDetTime);
 
 	if (int error{ CPXmipopt(env, model) })
 		throw MIPException(MIPEx::MIP_OptimizationError, "CPLEX cannot solve this problem!\t" + std::to_string(error));
 
+	CPXgetdettime(env, &endDetTime);
+	lastDetTime = endDetTime - startDetTime;
+
 	return CPXgetstat(env, model);
 }
 
@@ -40,18 +54,24 @@ int RlxFMIP::solveRelaxation(const double timeLimit, const double detTimeLimit)
 	if (detTimeLimit < CPX_INFBOUND) [[likely]]
 		CPXsetdblparam(env, CPX_PARAM_DETTILIM, detTimeLimit);
 
-	changeProbType(CPXPROB_MILP); // Necessary to get vars type
-
-	for (size_t i{ 0 }; i < getNumCols(); i++) {
-		char type = getVarType(i);
-		if (type == CPX_BINARY || type == CPX_INTEGER)
-			restoreVarType[i] = type;
+	double startDetTime{ 0.0 }, endDetTime{ 0.0 };
+	CPXgetdettime(env, &startDetTime);
+
+	// Bound changes keep the basis dual feasible: re-optimize from it
+	int error;
+	if (relaxed)
+		error = CPXdualopt(env, model);
+	else {
+		changeProbType(CPXPROB_LP);
+		relaxed = true;
+		error = CPXlpopt(env, model);
 	}
-	changeProbType(CPXPROB_LP);
-
-	if (int error{ CPXlpopt(env, model) })
+	if (error)
 		throw MIPException(MIPEx::LP_OptimizationError, "CPLEX cannot solve the relaxed problem!\t" + std::to_string(error));
 
+	CPXgetdettime(env, &endDetTime);
+	lastDetTime = endDetTime - startDetTime;
+
 	return CPXgetstat(env, model);
 }
 
@@ -0,0 +1,328 @@
+/**
+ * Tuning driver: iterated racing of ACS configurations on a local worker pool
+ *
+ * Every run is an ACS process (same build directory) writing its outcome with -rf;
+ * the race (IteratedRace) keeps up to -w processes running at once.
+ *
+ * @author Francesco Biscaccia Carrara
+ * @version v1.2.11
+ * @since 15/09/2025
+ */
+
+#include <fcntl.h>
+#include <filesystem>
+#include <iomanip>
+#include <nlohmann/json.hpp>
+#include <spawn.h>
+#include <sys/wait.h>
+
+#include "../include/IteratedRace.hpp"
+
+#pragma region TUNER_DEF
+
+#define TUNER_DEF_INSTANCES "../test/scripts/data/fHard_instances.csv"
+#define TUNER_DEF_OUTPUT "../test/scripts/tmp/tuning.json"
+#define TUNER_DEF_LOG_DIR "../test/scripts/tmp/tuning/"
+#define TUNER_DEF_EXEC "./ACS"
+#define TUNER_DEF_BUDGET 200
+#define TUNER_DEF_TL 300.0
+#define TUNER_DEF_CORES 4
+
+/** Weight of the fraction of the time limit used in the score of a run (breaks ties on the gap) */
+#define TUNER_TIME_WEIGHT 1e-2
+/** Score of a run without a feasible solution (worse than any feasible run) */
+#define TUNER_NO_SOL_SCORE (1.0 + 2 * TUNER_TIME_WEIGHT)
+
+#pragma endregion
+
+extern char** environ;
+
+constexpr const char* HELP_TUNER = R"(
+ACS Tuner - Iterated racing of ACS configurations
+
+USAGE:
+    ./Tuner [OPTIONS]          (from the build directory, next to ./ACS)
+
+OPTIONS:
+      -h, --help                    Display this help message and exit
+
+      -i, --instances <csv>         Instance list, name and reference objective
+                                    per row (default: fHard_instances.csv)
+
+      -ps, --space <file>           Parameter space, one parameter per line:
+                                    <name> <ACS flag> r|i <min> <max>
+                                    <name> <ACS flag> c <choice> [<choice> ...]
+                                    (default: rho, numsubMIPs, walkProb,
+                                    DET_TL scale and fixing policy)
+
+      -b, --budget <runs>           Total number of ACS runs (default: 200)
+
+      -tl, --timelimit <seconds>    Time limit of every ACS run (default: 300)
+
+      -c, --cores <num>             Cores of every ACS run (default: 4)
+
+      -w, --workers <num>           Concurrent ACS runs
+                                    (default: hardware threads / cores)
+
+      -sd, --seed <value>           Seed of the sampling, of the instance order
+                                    and of the ACS seeds (default: random)
+
+      -ex, --exec <path>            ACS executable (default: ./ACS)
+
+      -o, --output <file>           JSON with the best configuration, the elites
+                                    and the race log (default: tmp/tuning.json)
+
+      -ld, --logdir <dir>           Output and result file of every run
+                                    (default: tmp/tuning/)
+
+SCORE:
+    Primal gap with the reference objective (0 if unknown) plus a small weight
+    of the time used; runs without a feasible solution score worst.
+
+EXAMPLES:
+    ./Tuner -b 500 -tl 120 -c 4 -w 8
+    ./Tuner -i ../test/scripts/data/fHard_instances.csv -ps space.txt -b 1000
+)";
+
+/**
+ * @brief Arguments of the tuner
+ */
+struct TunerArgs {
+	std::string		   instances; ///< Instance list
+	std::string		   space;	  ///< Parameter space file (empty: built-in)
+	unsigned long	   budget;	  ///< Total number of runs
+	double			   timeLimit; ///< Time limit of every run
+	unsigned long	   numCores;  ///< Cores of every run
+	unsigned long	   workers;	  ///< Concurrent runs
+	unsigned long long seed;	  ///< Seed of the race
+	std::string		   exec;	  ///< ACS executable
+	std::string		   output;	  ///< Output JSON
+	std::string		   logDir;	  ///< Directory of the run outputs
+};
+
+/**
+ * @brief Formats a parameter value for the ACS command line.
+ * @param value Value
+ * @return Shortest decimal representation
+ */
+static std::string formatValue(double value) {
+	std::ostringstream oss;
+	oss << std::setprecision(10) << value;
+	return oss.str();
+}
+
+/**
+ * @brief Primal gap of a cost with a reference objective, within [0,1].
+ * @param cost Objective cost of the solution
+ * @param ref Reference objective
+ * @return Primal gap
+ */
+static double primalGap(double cost, double ref) {
+	if (std::abs(cost - ref) < EPSILON)
+		return 0.0;
+	if (cost * ref < 0.0)
+		return 1.0;
+	return std::abs(cost - ref) / std::max(std::abs(cost), std::abs(ref));
+}
+
+/**
+ * @brief Parses the command line of the tuner.
+ * @param argc Number of arguments
+ * @param argv Arguments
+ * @return Parsed arguments
+ */
+static TunerArgs parseArgs(int argc, char* argv[]) {
+	TunerArgs args{ .instances = TUNER_DEF_INSTANCES,
+					.space = "",
+					.budget = TUNER_DEF_BUDGET,
+					.timeLimit = TUNER_DEF_TL,
+					.numCores = TUNER_DEF_CORES,
+					.workers = 0,
+					.seed = static_cast<unsigned long long>(time(NULL)),
+					.exec = TUNER_DEF_EXEC,
+					.output = TUNER_DEF_OUTPUT,
+					.logDir = TUNER_DEF_LOG_DIR };
+
+	for (int i = 1; i < argc; i++) {
+		std::string arg = argv[i];
+		if (arg == "-h" || arg == "--help") {
+			printf("%s\n", HELP_TUNER);
+			std::exit(EXIT_SUCCESS);
+		}
+	}
+
+	constexpr std::array<std::pair<const char*, std::string TunerArgs::*>, 10> stringArgs{ { { "-i", &TunerArgs::instances },
+																							 { "--instances", &TunerArgs::instances },
+																							 { "-ps", &TunerArgs::space },
+																							 { "--space", &TunerArgs::space },
+																							 { "-ex", &TunerArgs::exec },
+																							 { "--exec", &TunerArgs::exec },
+																							 { "-o", &TunerArgs::output },
+																							 { "--output", &TunerArgs::output },
+																							 { "-ld", &TunerArgs::logDir },
+																							 { "--logdir", &TunerArgs::logDir } } };
+
+	constexpr std::array<std::pair<const char*, unsigned long TunerArgs::*>, 6> uLongArgs{ { { "-b", &TunerArgs::budget },
+																							 { "--budget", &TunerArgs::budget },
+																							 { "-c", &TunerArgs::numCores },
+																							 { "--cores", &TunerArgs::numCores },
+																							 { "-w", &TunerArgs::workers },
+																							 { "--workers", &TunerArgs::workers } } };
+
+	constexpr std::array<std::pair<const char*, double TunerArgs::*>, 2> doubleArgs{ { { "-tl", &TunerArgs::timeLimit }, { "--timelimit", &TunerArgs::timeLimit } } };
+
+	constexpr std::array<std::pair<const char*, unsigned long long TunerArgs::*>, 2> ullongArgs{ { { "-sd", &TunerArgs::seed }, { "--seed", &TunerArgs::seed } } };
+
+	for (int i = 1; i < argc - 1; i++) {
+		std::string key = argv[i];
+
+		for (const auto& [flag, member] : stringArgs) {
+			if (key == flag) {
+				args.*member = argv[++i];
+				break;
+			}
+		}
+
+		for (const auto& [flag, member] : uLongArgs) {
+			if (key == flag) {
+				args.*member = std::strtoul(argv[++i], nullptr, ARGS_CONV_BASE);
+				break;
+			}
+		}
+
+		for (const auto& [flag, member] : doubleArgs) {
+			if (key == flag) {
+				args.*member = std::strtod(argv[++i], nullptr);
+				break;
+			}
+		}
+
+		for (const auto& [flag, member] : ullongArgs) {
+			if (key == flag) {
+				args.*member = std::strtoull(argv[++i], nullptr, ARGS_CONV_BASE);
+				break;
+			}
+		}
+	}
+
+	if (!args.numCores || args.timeLimit < EPSILON)
+		throw ACSException(ACSException::ExceptionType::WrongArgsValue, "Wrong values passed as CLI args", "Tuner");
+	if (!args.workers)
+		args.workers = std::max(1ul, std::thread::hardware_concurrency() / args.numCores);
+	if (!args.logDir.empty() && args.logDir.back() != '/')
+		args.logDir += '/';
+	return args;
+}
+
+int main(int argc, char* argv[]) {
+	try {
+		Clock::initTime = Clock::getTime();
+
+		TunerArgs							  args{ parseArgs(argc, argv) };
+		std::vector<IteratedRace::Param>	  space{ IteratedRace::loadSpace(args.space) };
+		std::vector<IteratedRace::Instance> instances{ IteratedRace::loadInstances(args.instances) };
+		std::filesystem::create_directories(args.logDir);
+
+		printf("--------------------------------------------------------------------------------\n");
+		printf("\t\tACS Tuner \t%s -- Last update: %s\n", ACS_VERSION, LAST_UPDATE);
+		printf("--------------------------------------------------------------------------------\n");
+		PRINT_OUT("Instances: %zu [%s] -- Parameters: %zu -- Budget: %lu runs of %.0fs on %lu cores, %lu at once (at most %.1fh)", instances.size(), args.instances.c_str(), space.size(), args.budget, args.timeLimit, args.numCores,
+				  args.workers, args.budget * args.timeLimit / args.workers / 3600.0);
+
+		// One ACS process per run: output to <logDir>/<tag>.log, outcome to <logDir>/<tag>.json
+		auto evaluator = [&](const IteratedRace::Config& config, const IteratedRace::Instance& instance, unsigned long long seed) -> IteratedRace::Result {
+			std::string tag{ instance.name + "_" + std::to_string(config.id) + "_" + std::to_string(seed) };
+			std::string resPath{ args.logDir + tag + ".json" };
+			std::string logPath{ args.logDir + tag + ".log" };
+			std::filesystem::remove(resPath);
+
+			std::vector<std::string> cmd{ args.exec, "-f", instance.name, "-tl", formatValue(args.timeLimit), "-c", std::to_string(args.numCores), "-sd", std::to_string(seed), "-ag", std::to_string(config.id), "-rf", resPath };
+			for (size_t p{ 0 }; p < space.size(); p++) {
+				cmd.push_back(space[p].flag);
+				cmd.push_back(formatValue(config.values[p]));
+			}
+			std::vector<char*> cmdArgv;
+			for (std::string& s : cmd)
+				cmdArgv.push_back(s.data());
+			cmdArgv.push_back(nullptr);
+
+			posix_spawn_file_actions_t actions;
+			posix_spawn_file_actions_init(&actions);
+			posix_spawn_file_actions_addopen(&actions, STDOUT_FILENO, logPath.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+			posix_spawn_file_actions_adddup2(&actions, STDOUT_FILENO, STDERR_FILENO);
+
+			double wallTime{ Clock::getTime() };
+			pid_t  pid;
+			int	   status{ -1 };
+			if (!posix_spawn(&pid, args.exec.c_str(), &actions, nullptr, cmdArgv.data(), environ))
+				waitpid(pid, &status, 0);
+			posix_spawn_file_actions_destroy(&actions);
+			wallTime = Clock::timeElapsed(wallTime);
+
+			IteratedRace::Result result{ .feasible = false, .cost = std::numeric_limits<double>::quiet_NaN(), .gap = 1.0, .time = std::min(wallTime, args.timeLimit), .score = TUNER_NO_SOL_SCORE };
+			std::ifstream		 resFile(resPath);
+			nlohmann::json		 jsResult = resFile ? nlohmann::json::parse(resFile, nullptr, false) : nlohmann::json();
+			if (jsResult.is_object() && jsResult.value("feasible", false) && jsResult["cost"].is_number()) {
+				result.feasible = true;
+				result.cost = jsResult["cost"].get<double>();
+				result.time = std::min(jsResult.value("time", wallTime), args.timeLimit);
+				result.gap = std::isnan(instance.objective) ? 0.0 : primalGap(result.cost, instance.objective);
+				result.score = result.gap + TUNER_TIME_WEIGHT * result.time / args.timeLimit;
+			} else if (!WIFEXITED(status) || (WEXITSTATUS(status) != EXIT_SUCCESS && WEXITSTATUS(status) != NO_FEAS_SOL))
+				PRINT_WARN("Tuner: run %s failed (see %s)", tag.c_str(), logPath.c_str());
+
+#if ACS_VERBOSE >= VERBOSE
+			PRINT_INFO("Tuner: #%zu on %s [seed %llu] -- Cost: %.4f -- Gap: %.6f -- Time: %.2fs", config.id, instance.name.c_str(), seed, result.cost, result.gap, result.time);
+#endif
+			return result;
+		};
+
+		IteratedRace				 race(space, instances, args.budget, args.workers, args.seed, evaluator);
+		const IteratedRace::Config& best{ race.run() };
+
+		auto jsConfig = [&](size_t id) {
+			const IteratedRace::Config& config{ race.getConfigs()[id] };
+			nlohmann::json				 jsParams;
+			std::string					 cmd;
+			for (size_t p{ 0 }; p < space.size(); p++) {
+				jsParams[space[p].name] = config.values[p];
+				cmd += " " + space[p].flag + " " + formatValue(config.values[p]);
+			}
+			return nlohmann::json{ { "id", config.id }, { "parent", config.parent }, { "iteration", config.iteration }, { "params", jsParams }, { "args", cmd.substr(std::min<size_t>(1, cmd.size())) }, { "meanScore", race.meanScore(id) }, { "blocks", race.numRuns(id) } };
+		};
+
+		nlohmann::json jsData;
+		jsData["settings"] = { { "instances", args.instances }, { "budget", args.budget }, { "timeLimit", args.timeLimit }, { "cores", args.numCores }, { "workers", args.workers }, { "seed", args.seed }, { "iterations", race.getNumIterations() }, { "space", nlohmann::json::array() } };
+		for (const auto& param : space)
+			jsData["settings"]["space"].push_back({ { "name", param.name }, { "flag", param.flag }, { "type", std::string(1, param.type) }, { "values", param.values } });
+		jsData["best"] = jsConfig(best.id);
+		jsData["elites"] = nlohmann::json::array();
+		for (size_t id : race.getElites())
+			jsData["elites"].push_back(jsConfig(id));
+		jsData["configs"] = nlohmann::json::array();
+		for (const auto& config : race.getConfigs())
+			jsData["configs"].push_back(jsConfig(config.id));
+		jsData["runs"] = nlohmann::json::array();
+		for (const auto& run : race.getRuns()) {
+			const IteratedRace::Block& block{ race.getBlocks()[run.block] };
+			jsData["runs"].push_back({ { "config", run.config }, { "block", run.block }, { "instance", instances[block.instance].name }, { "seed", block.seed }, { "feasible", run.result.feasible },
+									   { "cost", run.result.feasible ? nlohmann::json(run.result.cost) : nlohmann::json() }, { "gap", run.result.gap }, { "time", run.result.time }, { "score", run.result.score } });
+		}
+		jsData["tests"] = nlohmann::json::array();
+		for (const auto& test : race.getTests())
+			jsData["tests"].push_back({ { "iteration", test.iteration }, { "blocks", test.blocks }, { "alive", test.alive }, { "statistic", test.statistic }, { "pValue", test.pValue }, { "eliminated", test.eliminated } });
+
+		std::ofstream oFile(args.output);
+		oFile << jsData.dump(4);
+		oFile.close();
+
+		printf("--------------------------------------------------------------------------------\n");
+		PRINT_BEST("Best configuration #%zu: %s \n\t\t   Mean score: %.6f on %zu blocks -- Runs: %zu -- Time elapsed: %.2fs", best.id, jsData["best"]["args"].get<std::string>().c_str(), race.meanScore(best.id), race.numRuns(best.id), race.getRuns().size(),
+				   Clock::timeElapsed());
+		PRINT_OUT("JSON: Race log saved on %s", args.output.c_str());
+	} catch (const ACSException& ex) {
+		PRINT_ERR(ex.what());
+		return ex.getErrorCode();
+	}
+	return EXIT_SUCCESS;
+}
@@ -114,6 +114,36 @@ double Clock::timeRemaining(const double timeLimit) {
 	return timeLimit - timeElapsed();
 }
 
+size_t UCB::pick(const std::vector<Arm>& arms, const double c) {
+	size_t totPicks{ 0 };
+	for (size_t a{ 0 }; a < arms.size(); a++) {
+		if (!arms[a].available)
+			continue;
+		if (!arms[a].picks)
+			return a;
+		totPicks += arms[a].picks;
+	}
+
+	double maxReward{ 0.0 };
+	for (const Arm& arm : arms)
+		if (arm.available && arm.solves && arm.cost > EPSILON)
+			maxReward = std::max(maxReward, arm.gain / arm.cost);
+
+	size_t bestArm{ 0 };
+	double bestScore{ -std::numeric_limits<double>::infinity() };
+	for (size_t a{ 0 }; a < arms.size(); a++) {
+		if (!arms[a].available)
+			continue;
+		double reward{ (arms[a].solves && arms[a].cost > EPSILON && maxReward > 0.0) ? (arms[a].gain / arms[a].cost) / maxReward : 0.0 };
+		double score{ reward + c * std::sqrt(std::log(static_cast<double>(totPicks)) / arms[a].picks) };
+		if (score > bestScore) {
+			bestScore = score;
+			bestArm = a;
+		}
+	}
+	return bestArm;
+}
+
 constexpr const char* HELP_ACS = R"(
 ACS - Alternating Criteria Search Optimizer
 Version: )" ACS_VERSION R"(| Last Update: )" LAST_UPDATE R"(
@@ -142,22 +172,118 @@ OPTIONS:
                                     Percentage of variables to fix per ACS iteration
                                     (default: 0.1, optimal for most problems)
 
+      -rc, --rhocont <ratio>        Continuous variable fixing ratio (0.0-1.0)
+                                    Rho applies to the integer variables; this
+                                    fraction of the continuous ones is fixed too
+                                    (default: 0, continuous variables left free)
+
+      -pb, --walkprob <prob>        Probability of a random move of the WalkMIP
+                                    fixing policy (0.0-1.0) (default: 0.1)
+
+      -ds, --detscale <scale>       Scale of the deterministic time limit of every
+                                    subMIP and merge MIP, DET_TL(nnz) (default: 1.0)
+
       -th, --theta <ratio>          Initial variable fixing ratio (0.0-1.0)
                                     Percentage of variables to fix in initial vector
                                     (default: 0.5)	                            
+
+      -fj, --feasjump <seconds>     Wall time of the Feasibility Jump local search
+                                    run before the first FMIP phase; its best
+                                    assignments seed the subMIPs (default: 0, off)
+
+      -ms, --multistart <0|1>       Build one starting vector per subMIP in parallel
+                                    (MaxFeas with different seeds, LP dives with
+                                    different thetas), ranked by violation (default: 0)
+
+      -ep, --elitepool <size>       Keep up to <size> distinct good solutions: they
+                                    join the recombinations and restart some subMIPs
+                                    away from the incumbent (default: 0, off)
+
+      -nc, --nbhcache <0|1>         Remember the outcome of every subMIP neighborhood
+                                    around the incumbent and redraw or skip the ones
+                                    known to be unproductive (default: 0)
+
+      -bp, --propagate <0|1>        Propagate the bounds of every fixed subMIP before
+                                    the solve: infeasible fixings are redrawn, tightened
+                                    integer bounds are passed to CPLEX (default: 0)
+
+      -im, --improve <phases>       Keep running OMIP phases after the first feasible
+                                    solution, until the time limit or <phases>
+                                    consecutive phases without improvement
+                                    (default: 0, stop at the first feasible solution)
+
+      -ac, --autoconfig <0|1>       Pick rho, numsubMIPs, the fixing policy and the
+                                    DET_TL scale from the features of the instance
+                                    (size, density, variable types, row lengths,
+                                    equality rows); overrides -rh, -nSMIPs, -fx
+                                    (default: 0)
+
+      -ar, --autorules <file>       Rules file of -ac, one rule per line, e.g.
+                                    "nnz > 1e6 && eqFrac < 0.5 : rho=0.5 detScale=2"
+                                    (default: built-in table, see AutoConfig.hpp)
                                     
     Parallelization:
       -nSMIPs, --numsubMIPs <num>   Number of parallel subMIPs
                                     (default: 4, optimal for most systems)
                                     Note: Higher values may not improve performance
+
+      -el, --elastic <0|1>          Grow or shrink the number of subMIPs of each
+                                    phase between rounds, up to max(nSMIPs, cores)
+                                    (default: 0)
+
+      -dt, --deterministic <0|1>    Deterministic mode: same seed and cores give
+                                    the same incumbent trace (default: 0)
+
+      -pf, --portfolio <0|1>        Each subMIP draws its fixing policy from a
+                                    bandit rewarding improvement per second
+                                    (default: 0, random rho-fixing only)
+
+      -fx, --fixpolicy <id>         Fixing policy of every subMIP when the portfolio
+                                    is off: 0 random window, 1 uniform random,
+                                    2 WalkMIP (FMIP only), 3 graph BFS,
+                                    4 graph random walk, 5 RINS (root LP agreement),
+                                    6 root LP reduced costs, 7 one free block of
+                                    the decomposition, 8 local branching
+                                    (default: 0)
+
+    Distributed:
+      -co, --coordinator <port>     Run as coordinator: listen on the TCP port and
+                                    send subMIP specs to the worker processes
+                                    (default: 0, off)
+
+      -nr, --numremote <num>        Number of worker processes the coordinator
+                                    waits for at startup (default: 0)
+
+      -wk, --worker <port>          Run as worker of the coordinator listening on
+                                    the TCP port (same -f instance, -c cores)
+
+      -ho, --host <address>         Host of the coordinator (default: 127.0.0.1)
+
+      -c, --cores <num>             Core budget split among the CPLEX threads of
+                                    the subMIPs; merge MIPs use all of it
+                                    (default: all the hardware threads)
+
+      -pn, --pin <0|1>              Pin each subMIP worker and its CPLEX threads
+                                    to a core set of one NUMA node (default: 0)
+
+      -pp, --pipeline <0|1>         Build and fix the subMIPs of the next phase
+                                    while the merge MIP solves (default: 1)
                                     
     Miscellaneous:
       -sd, --seed <value>           Random seed for reproducible results
                                     (default: random system generated value)
 
+      -ag, --algo <id>              Algorithm variant, used to label the run
+                                    in the JSON output (default: 0)
+
+      -rf, --resultfile <path>      Write the outcome of the run (cost, slack,
+                                    time, primal integral) to a JSON file, also
+                                    without -DTEST=1 (used by the Tuner)
+
 EXAMPLES:
     ./ACS -f problem -tl 1800 -rh 0.6
     ./ACS --filename instance01 --timelimit 3600 --numsubMIPs 8 --seed 12345
+    ./ACS -f problem -tl 1800 -co 5555 -nr 2 & ./ACS -f problem -tl 1800 -wk 5555 & ./ACS -f problem -tl 1800 -wk 5555
 
 EXIT CODES:
     Success:
@@ -185,6 +311,9 @@ EXIT CODES:
       1011    File not found - Verify filename and data/ directory
       1012    Input size error - Problem dimensions exceed limits
       1013    Wrong argument values - Invalid parameter values provided
+
+    Distributed Mode Errors:
+      1014    Network error - Socket setup or coordinator unreachable
     
 
 For detailed error descriptions and handling, see ACSException.hpp
@@ -196,14 +325,39 @@ Report bugs to: francesco.biscaccia.carrara@gmail.com
 constexpr const char* HELP_CPLEXRUN = "Usage: ./CPLEXRun <PARS>\
         \n '-h  / --help'\t\t\t\t Show help message\
         \n '-f  / --filename <string>'\t\t Input file\
-        \n '-tl / --timelimit <double>'\t\t Max execution time";
+        \n '-tl / --timelimit <double>'\t\t Max execution time\
+        \n '-c  / --cores <int>'\t\t\t Number of CPLEX threads";
 
 CLIParser::CLIParser(int argc, char* argv[], bool CPLEXRun) : 
 	args{.fileName = "", 
 			.timeLimit = DEF_TL, 
 			.rho = DEF_RHO, 
 			.numsubMIPs = DEF_SUBMIPS,
-			.seed=0}
+			.seed=0,
+			.algo=0,
+			.numCores=0,
+			.pin=0,
+			.pipeline=1,
+			.elastic=0,
+			.deterministic=0,
+			.portfolio=0,
+			.fixPolicy=0,
+			.coordinator=0,
+			.numRemote=0,
+			.worker=0,
+			.host="127.0.0.1",
+			.feasJump=0.0,
+			.multiStart=0,
+			.elitePool=0,
+			.nbhCache=0,
+			.propagate=0,
+			.rhoCont=0.0,
+			.improve=0,
+			.autoConfig=0,
+			.autoRules="",
+			.walkProb=DEF_WALK_PROB,
+			.detScale=1.0,
+			.resultFile=""}
 			
 	{ 
 		srand (time(NULL));
@@ -221,18 +375,66 @@ CLIParser::CLIParser(int argc, char* argv[], bool CPLEXRun) :
 				}
 			}
 
-			constexpr std::array<std::pair<const char*, std::string Args::*>, 2> stringArgs{ {
+			constexpr std::array<std::pair<const char*, std::string Args::*>, 8> stringArgs{ {
 				{ "-f", &Args::fileName },
 				{ "--filename", &Args::fileName },
+				{ "-ho", &Args::host },
+				{ "--host", &Args::host },
+				{ "-ar", &Args::autoRules },
+				{ "--autorules", &Args::autoRules },
+				{ "-rf", &Args::resultFile },
+				{ "--resultfile", &Args::resultFile },
 			} };
 
-			constexpr std::array<std::pair<const char*, unsigned long Args::*>, 2> uLongArgs{ { { "-nSMIPs", &Args::numsubMIPs },
-																								{ "--numsubMIPs", &Args::numsubMIPs } } };
-
-			constexpr std::array<std::pair<const char*, double Args::*>, 4> doubleArgs{ { { "-tl", &Args::timeLimit },
+			constexpr std::array<std::pair<const char*, unsigned long Args::*>, 36> uLongArgs{ { { "-nSMIPs", &Args::numsubMIPs },
+																								{ "--numsubMIPs", &Args::numsubMIPs },
+																								{ "-ag", &Args::algo },
+																								{ "--algo", &Args::algo },
+																								{ "-c", &Args::numCores },
+																								{ "--cores", &Args::numCores },
+																								{ "-pn", &Args::pin },
+																								{ "--pin", &Args::pin },
+																								{ "-pp", &Args::pipeline },
+																								{ "--pipeline", &Args::pipeline },
+																								{ "-el", &Args::elastic },
+																								{ "--elastic", &Args::elastic },
+																								{ "-dt", &Args::deterministic },
+																								{ "--deterministic", &Args::deterministic },
+																								{ "-pf", &Args::portfolio },
+																								{ "--portfolio", &Args::portfolio },
+																								{ "-fx", &Args::fixPolicy },
+																								{ "--fixpolicy", &Args::fixPolicy },
+																								{ "-co", &Args::coordinator },
+																								{ "--coordinator", &Args::coordinator },
+																								{ "-nr", &Args::numRemote },
+																								{ "--numremote", &Args::numRemote },
+																								{ "-wk", &Args::worker },
+																								{ "--worker", &Args::worker },
+																								{ "-ms", &Args::multiStart },
+																								{ "--multistart", &Args::multiStart },
+																								{ "-ep", &Args::elitePool },
+																								{ "--elitepool", &Args::elitePool },
+																								{ "-nc", &Args::nbhCache },
+																								{ "--nbhcache", &Args::nbhCache },
+																								{ "-bp", &Args::propagate },
+																								{ "--propagate", &Args::propagate },
+																								{ "-im", &Args::improve },
+																								{ "--improve", &Args::improve },
+																								{ "-ac", &Args::autoConfig },
+																								{ "--autoconfig", &Args::autoConfig } } };
+
+			constexpr std::array<std::pair<const char*, double Args::*>, 12> doubleArgs{ { { "-tl", &Args::timeLimit },
 																						  { "--timelimit", &Args::timeLimit },
 																						  { "-rh", &Args::rho },
-																						  { "--rho", &Args::rho } } };
+																						  { "--rho", &Args::rho },
+																						  { "-rc", &Args::rhoCont },
+																						  { "--rhocont", &Args::rhoCont },
+																						  { "-fj", &Args::feasJump },
+																						  { "--feasjump", &Args::feasJump },
+																						  { "-pb", &Args::walkProb },
+																						  { "--walkprob", &Args::walkProb },
+																						  { "-ds", &Args::detScale },
+																						  { "--detscale", &Args::detScale } } };
 
 			constexpr std::array<std::pair<const char*, unsigned long long Args::*>, 2> ullongArgs{ {
 				{ "-sd", &Args::seed },
@@ -271,6 +473,9 @@ CLIParser::CLIParser(int argc, char* argv[], bool CPLEXRun) :
 				}
 			}
 
+			if (!args.numCores)
+				args.numCores = std::max(1u, std::thread::hardware_concurrency());
+
 			if (CPLEXRun) {
 				if (args.fileName.empty() || !args.timeLimit) {
 					printf("%s\n", HELP_CPLEXRUN);
@@ -281,6 +486,10 @@ CLIParser::CLIParser(int argc, char* argv[], bool CPLEXRun) :
 					printf("%s\n", HELP_ACS);
 					throw ArgsParserException(ExType::WrongArgsValue, "Wrong values passed as CLI args");
 				}
+				if (args.coordinator && args.worker)
+					throw ArgsParserException(ExType::WrongArgsValue, "A process cannot be both coordinator and worker");
+				if (args.detScale < EPSILON)
+					throw ArgsParserException(ExType::WrongArgsValue, "The DET_TL scale must be positive");
 			}
 
 			printf("--------------------------------------------------------------------------------\n");
@@ -293,16 +502,40 @@ CLIParser::CLIParser(int argc, char* argv[], bool CPLEXRun) :
 		if (CPLEXRun) {
 			PRINT_INFO("Parsed Arguments:\
 							\n\t - File Name :  \t%s \
-							\n\t - Time Limit : \t%f",
-					   args.fileName.c_str(), args.timeLimit);
+							\n\t - Time Limit : \t%f\
+							\n\t - Num cores : \t%d",
+					   args.fileName.c_str(), args.timeLimit, args.numCores);
 		} else {
 			PRINT_INFO("Parsed Arguments:\
                             \n\t - File Name :  \t%s \
                             \n\t - Time Limit : \t%f\
                             \n\t - Rho : \t\t%f\
+                            \n\t - Continuous rho : \t%f\
 							\n\t - Seed : \t\t%d\
-							\n\t - Num sub-MIP : \t%d",
-					    	args.fileName.c_str(), args.timeLimit, args.rho, args.seed, args.numsubMIPs);
+							\n\t - Num sub-MIP : \t%d\
+							\n\t - Num cores : \t%d\
+							\n\t - Pin workers : \t%d\
+							\n\t - Pipeline : \t%d\
+							\n\t - Elastic sub-MIPs : \t%d\
+							\n\t - Deterministic : \t%d\
+							\n\t - Policy portfolio : \t%d\
+							\n\t - Fixing policy : \t%d\
+							\n\t - Coordinator port : \t%d\
+							\n\t - Remote workers : \t%d\
+							\n\t - Worker port : \t%d\
+							\n\t - Coordinator host : \t%s\
+							\n\t - FeasJump time : \t%f\
+							\n\t - Multi-start : \t%d\
+							\n\t - Elite pool : \t%d\
+							\n\t - Neighborhood cache : \t%d\
+							\n\t - Bound propagation : \t%d\
+							\n\t - Improvement stall : \t%d\
+							\n\t - Auto configuration : \t%d\
+							\n\t - Auto config rules : \t%s\
+							\n\t - Walk probability : \t%f\
+							\n\t - DET_TL scale : \t%f\
+							\n\t - Result file : \t%s",
+					    	args.fileName.c_str(), args.timeLimit, args.rho, args.rhoCont, args.seed, args.numsubMIPs, args.numCores, args.pin, args.pipeline, args.elastic, args.deterministic, args.portfolio, args.fixPolicy, args.coordinator, args.numRemote, args.worker, args.host.c_str(), args.feasJump, args.multiStart, args.elitePool, args.nbhCache, args.propagate, args.improve, args.autoConfig, args.autoRules.empty() ? "built-in" : args.autoRules.c_str(), args.walkProb, args.detScale, args.resultFile.empty() ? "-" : args.resultFile.c_str());
 		}
 
 #endif
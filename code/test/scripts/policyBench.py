@@ -0,0 +1,45 @@
+import sys, os, json
+
+sys.dont_write_bytecode = True
+
+# Compares the fixing policies on the JSON files written by ACS (ACS_TEST build),
+# e.g. runs with -pf 1 or one run per -fx value with the same seeds.
+# FMIP improvement is slack reduction, OMIP improvement is objective reduction.
+
+PHASES = ("FMIP", "OMIP")
+
+
+def main(folder):
+    totals = {}
+
+    for name in sorted(os.listdir(folder)):
+        if not name.endswith(".json"): continue
+        with open(os.path.join(folder, name), 'r') as file:
+            JSdata = json.load(file)
+
+        for inst in JSdata:
+            for algo in JSdata[inst]:
+                for seed in JSdata[inst][algo]:
+                    run = JSdata[inst][algo][seed]
+                    if len(run) < 3 or "portfolio" not in run[2]: continue
+                    for phase in PHASES:
+                        for policy, st in run[2]["portfolio"].get(phase, {}).items():
+                            if not st["solves"]: continue
+                            acc = totals.setdefault((phase, policy), [0, 0, 0, 0.0, 0.0])
+                            acc[0] += 1
+                            acc[1] += st["solves"]
+                            acc[2] += st.get("infeasible", 0)
+                            acc[3] += st["improvement"]
+                            acc[4] += st["ticks"]
+
+    print(f"{'Phase':<6}{'Policy':<13}{'Runs':>6}{'Solves':>9}{'No sol':>9}{'Improvement':>14}{'Ticks':>14}{'Impr/Ktick':>12}")
+    for (phase, policy), (runs, solves, noSol, impr, ticks) in sorted(totals.items()):
+        rate = 1e3 * impr / ticks if ticks > 0 else 0.0
+        print(f"{phase:<6}{policy:<13}{runs:>6}{solves:>9}{noSol:>9}{impr:>14.4f}{ticks:>14.1f}{rate:>12.6f}")
+
+
+if __name__ == "__main__":
+    if len(sys.argv) == 1:
+        print("No folder passed to the main function.")
+        exit(1)
+    else: main(sys.argv[1])